@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <LibJsonValidator/Bytecode.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+#include <stdio.h>
+
+namespace JsonValidator {
+
+const char* to_string(OpCode opcode)
+{
+    switch (opcode) {
+#define __ENUMERATE_OPCODE(name) \
+    case OpCode::name:           \
+        return #name;
+        __ENUMERATE_OPCODE(CheckType)
+        __ENUMERATE_OPCODE(CheckPresent)
+        __ENUMERATE_OPCODE(JumpIfNotType)
+        __ENUMERATE_OPCODE(Fail)
+        __ENUMERATE_OPCODE(Call)
+        __ENUMERATE_OPCODE(BeginBranches)
+        __ENUMERATE_OPCODE(CallBranch)
+        __ENUMERATE_OPCODE(JumpIfMatches)
+        __ENUMERATE_OPCODE(TaggedBranches)
+        __ENUMERATE_OPCODE(EndAnyOf)
+        __ENUMERATE_OPCODE(EndOneOf)
+        __ENUMERATE_OPCODE(EndNot)
+        __ENUMERATE_OPCODE(Enum)
+        __ENUMERATE_OPCODE(Pattern)
+        __ENUMERATE_OPCODE(MinLength)
+        __ENUMERATE_OPCODE(MaxLength)
+        __ENUMERATE_OPCODE(Format)
+        __ENUMERATE_OPCODE(Minimum)
+        __ENUMERATE_OPCODE(Maximum)
+        __ENUMERATE_OPCODE(ExclusiveMinimum)
+        __ENUMERATE_OPCODE(ExclusiveMaximum)
+        __ENUMERATE_OPCODE(MultipleOf)
+        __ENUMERATE_OPCODE(MinProperties)
+        __ENUMERATE_OPCODE(MaxProperties)
+        __ENUMERATE_OPCODE(DependentSchema)
+        __ENUMERATE_OPCODE(Properties)
+        __ENUMERATE_OPCODE(MinItems)
+        __ENUMERATE_OPCODE(MaxItems)
+        __ENUMERATE_OPCODE(UniqueItems)
+        __ENUMERATE_OPCODE(Items)
+        __ENUMERATE_OPCODE(TupleItems)
+        __ENUMERATE_OPCODE(Contains)
+        __ENUMERATE_OPCODE(Return)
+#undef __ENUMERATE_OPCODE
+    }
+    return "";
+}
+
+Program::Program()
+{
+    pthread_mutex_init(&m_key_classifications_lock, nullptr);
+}
+
+Program::~Program()
+{
+    pthread_mutex_destroy(&m_key_classifications_lock);
+}
+
+NonnullOwnPtr<Program> Program::clone() const
+{
+    auto program = make<Program>();
+    program->m_code = m_code;
+    program->m_subroutines = m_subroutines;
+    program->m_indices = m_indices;
+    program->m_property_entries = m_property_entries;
+    program->m_pattern_properties = m_pattern_properties;
+    program->m_property_tables = m_property_tables;
+    program->m_tuple_tables = m_tuple_tables;
+    program->m_dependent_required_tables = m_dependent_required_tables;
+    program->m_tagged_union_tables = m_tagged_union_tables;
+    program->m_numbers = m_numbers;
+    program->m_strings = m_strings;
+    program->m_symbols = m_symbols;
+    program->m_enum_sets = m_enum_sets;
+    for (auto& pattern : m_patterns)
+        program->add_pattern(pattern.source());
+    program->m_pattern_sets = m_pattern_sets;
+    return program;
+}
+
+static const size_t max_cached_keys = 1024;
+
+bool KeyClassificationCache::find(const String& key, KeyClassification& classification)
+{
+    auto slot = m_slots.get(key);
+    if (!slot.has_value())
+        return false;
+    auto& entry = m_entries[slot.value()];
+    entry.referenced = true;
+    classification = entry.classification;
+    return true;
+}
+
+void KeyClassificationCache::add(const String& key, const KeyClassification& classification)
+{
+    if (m_entries.size() < max_cached_keys) {
+        m_slots.set(key, m_entries.size());
+        m_entries.append({ key, classification, false });
+        return;
+    }
+
+    while (m_entries[m_hand].referenced) {
+        m_entries[m_hand].referenced = false;
+        m_hand = (m_hand + 1) % m_entries.size();
+    }
+    auto& entry = m_entries[m_hand];
+    m_slots.remove(entry.key);
+    m_slots.set(key, m_hand);
+    entry = { key, classification, false };
+    m_hand = (m_hand + 1) % m_entries.size();
+}
+
+bool Program::find_key_classification(u32 table, const String& key, KeyClassification& classification) const
+{
+    pthread_mutex_lock(&m_key_classifications_lock);
+    bool found = table < m_key_classifications.size() && m_key_classifications[table].find(key, classification);
+    pthread_mutex_unlock(&m_key_classifications_lock);
+    return found;
+}
+
+void Program::cache_key_classification(u32 table, const String& key, const KeyClassification& classification) const
+{
+    pthread_mutex_lock(&m_key_classifications_lock);
+    if (m_key_classifications.is_empty())
+        m_key_classifications.resize(m_property_tables.size());
+    m_key_classifications[table].add(key, classification);
+    pthread_mutex_unlock(&m_key_classifications_lock);
+}
+
+void Program::dump() const
+{
+    for (size_t i = 0; i < m_subroutines.size(); ++i)
+        printf("sub%zu: @%u (%s)\n", i, m_subroutines[i].entry, location(i).characters());
+
+    for (size_t pc = 0; pc < m_code.size(); ++pc) {
+        auto& insn = m_code[pc];
+        printf("%5zu  %-20s", pc, to_string(insn.opcode));
+
+        switch (insn.opcode) {
+        case OpCode::CheckType:
+        case OpCode::JumpIfNotType:
+            printf("%s -> %u", type_mask_to_string(insn.a).characters(), insn.b);
+            break;
+        case OpCode::CheckPresent:
+            printf("-> %u", insn.b);
+            break;
+        case OpCode::JumpIfMatches:
+            printf("%u -> %u", insn.a, insn.b);
+            break;
+        case OpCode::Call:
+        case OpCode::CallBranch:
+        case OpCode::Items:
+        case OpCode::Contains:
+            printf("sub%u", insn.a);
+            break;
+        case OpCode::Pattern:
+            printf("/%s/", m_patterns[insn.a].source().characters());
+            break;
+        case OpCode::Format:
+            printf("%s", to_string((Format)insn.a));
+            break;
+        case OpCode::Minimum:
+        case OpCode::Maximum:
+        case OpCode::ExclusiveMinimum:
+        case OpCode::ExclusiveMaximum:
+        case OpCode::MultipleOf:
+            printf("%f", m_numbers[insn.a].value());
+            break;
+        case OpCode::TaggedBranches: {
+            auto& table = m_tagged_union_tables[insn.a];
+            printf("\"%s\" %u tags", m_strings[table.property].characters(), table.offsets.count - 1);
+            for (u32 i = 0; i < table.branches.count; ++i)
+                printf(" sub%u", m_indices[table.branches.first + i]);
+            break;
+        }
+        case OpCode::DependentSchema:
+            printf("\"%s\" sub%u", m_strings[insn.a].characters(), insn.b);
+            break;
+        case OpCode::MinItems:
+        case OpCode::MaxItems:
+            printf("%u -> %u", insn.a, insn.b);
+            break;
+        case OpCode::Enum:
+            printf("%u (%zu items)", insn.a, m_enum_sets[insn.a].size());
+            break;
+        case OpCode::MinLength:
+        case OpCode::MaxLength:
+        case OpCode::MinProperties:
+        case OpCode::MaxProperties:
+        case OpCode::Properties:
+        case OpCode::TupleItems:
+            printf("%u", insn.a);
+            break;
+        default:
+            break;
+        }
+        printf("\n");
+    }
+}
+
+}
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/JsonValue.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullOwnPtrVector.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJsonValidator/EnumSet.h>
+#include <LibJsonValidator/Format.h>
+#include <LibJsonValidator/Forward.h>
+#include <LibJsonValidator/NumberConstant.h>
+#include <LibJsonValidator/Pattern.h>
+#include <pthread.h>
+#include <string.h>
+
+namespace JsonValidator {
+
+// Every instruction works on the instance value of the subroutine it is executed in.
+// Operands are either immediates or indices into one of the side tables of the Program.
+// Jump targets are absolute instruction indices.
+enum class OpCode : u8 {
+    // a = TypeMask, b = jump target. Fails and jumps if the type of the instance is not in the mask.
+    CheckType,
+    // b = jump target. Fails and jumps if the instance is undefined.
+    CheckPresent,
+    // a = TypeMask, b = jump target. Jumps without failing if the type of the instance is not in the mask.
+    JumpIfNotType,
+    // Unconditional failure (the `false` schema).
+    Fail,
+
+    // a = subroutine. Validates the instance against the subroutine ($ref).
+    Call,
+    // Resets the match counter for a group of anyOf/oneOf/not branches.
+    BeginBranches,
+    // a = subroutine. Validates the instance without collecting errors, counts matches.
+    CallBranch,
+    // a = match count, b = jump target. Jumps if at least `a` branches matched.
+    JumpIfMatches,
+    // a = tagged union table. Counts the matches of the branches that the tag of an
+    // object instance selects, or of all branches for other instances.
+    TaggedBranches,
+    EndAnyOf,
+    EndOneOf,
+    EndNot,
+
+    // a = enum set
+    Enum,
+
+    // a = pattern
+    Pattern,
+    // a = length
+    MinLength,
+    MaxLength,
+    // a = Format, instances that aren't strings pass
+    Format,
+
+    // a = number constant
+    Minimum,
+    Maximum,
+    ExclusiveMinimum,
+    ExclusiveMaximum,
+    MultipleOf,
+
+    // a = count
+    MinProperties,
+    MaxProperties,
+    // a = symbol, b = subroutine
+    DependentSchema,
+    // a = property table. Also checks required and dependentRequired.
+    Properties,
+
+    // a = count, b = jump target. Fails and jumps on violation.
+    MinItems,
+    MaxItems,
+    UniqueItems,
+    // a = subroutine. Validates every item against the subroutine.
+    Items,
+    // a = tuple table. Validates items by position, remaining items against additionalItems.
+    TupleItems,
+    // a = subroutine
+    Contains,
+
+    // End of subroutine.
+    Return,
+};
+
+const char* to_string(OpCode);
+
+// Whether operand b of the instruction is a jump target.
+inline bool is_jump(OpCode opcode)
+{
+    switch (opcode) {
+    case OpCode::CheckType:
+    case OpCode::CheckPresent:
+    case OpCode::JumpIfNotType:
+    case OpCode::JumpIfMatches:
+    case OpCode::MinItems:
+    case OpCode::MaxItems:
+        return true;
+    default:
+        return false;
+    }
+}
+
+struct Instruction {
+    OpCode opcode;
+    u32 a { 0 };
+    u32 b { 0 };
+};
+
+// The tables of a Program refer to each other and to its pools by 32-bit index only,
+// so apart from the strings, symbols, constants and compiled patterns a Program is a
+// handful of flat arrays of plain structs.
+static constexpr u32 invalid_index = 0xffffffff;
+
+// A run of `count` consecutive entries of one of the Program arrays.
+struct IndexRange {
+    u32 first { 0 };
+    u32 count { 0 };
+};
+
+struct Subroutine {
+    u32 entry { 0 };
+    // string
+    u32 location { invalid_index };
+};
+
+struct PropertyEntry {
+    // symbol
+    u32 name { 0 };
+    // invalid_index for names that are only required, not declared
+    u32 subroutine { 0 };
+};
+
+struct PatternProperty {
+    // string
+    u32 source { 0 };
+    u32 subroutine { 0 };
+};
+
+// Property tables are minimal perfect hash tables over the declared property names
+// (hash and displace): the bucket of a name selects a displacement, and the displaced
+// hash selects the one slot the name can be in.
+inline u64 property_hash(const char* characters, size_t length, u32 seed)
+{
+    u64 hash = 0xcbf29ce484222325ULL ^ seed;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= (u8)characters[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+inline u32 property_bucket(u64 hash, u32 bucket_count)
+{
+    return (u32)(hash >> 32) % bucket_count;
+}
+
+inline u32 property_slot(u64 hash, u32 displacement, u32 slot_count)
+{
+    u64 x = hash ^ ((u64)displacement * 0x9e3779b97f4a7c15ULL);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (u32)(x % slot_count);
+}
+
+struct PropertyTable {
+    // property entries by hash slot, empty slots have the name invalid_index.
+    IndexRange properties;
+    // displacement of every hash bucket, indices
+    IndexRange displacements;
+    u32 hash_seed { 0 };
+    // The slot of a name is also its bit in the presence masks, which are stored as
+    // presence_words() indices. The mask of required properties, if any.
+    IndexRange required;
+    // dependent required tables
+    IndexRange dependent_required;
+    // pattern properties, and the pattern set that matches all of them at once
+    IndexRange pattern_properties;
+    u32 pattern_set { invalid_index };
+    u32 additional_properties { invalid_index };
+    u32 property_names { invalid_index };
+};
+
+inline u32 presence_words(const PropertyTable& table)
+{
+    return (table.properties.count + 31) / 32;
+}
+
+// What a property table makes of an instance key.
+struct KeyClassification {
+    // slot in the property table
+    u32 slot { invalid_index };
+    // matching pattern properties
+    RegexMatches patterns;
+    // neither a declared property nor matching a pattern property
+    bool additional { false };
+    bool property_name_valid { true };
+};
+
+// A bounded number of key classifications. When it is full, a CLOCK sweep replaces a key
+// that wasn't looked up since the hand last passed it.
+class KeyClassificationCache {
+public:
+    bool find(const String& key, KeyClassification&);
+    void add(const String& key, const KeyClassification&);
+
+private:
+    struct Entry {
+        String key;
+        KeyClassification classification;
+        bool referenced { false };
+    };
+
+    Vector<Entry> m_entries;
+    HashMap<String, u32> m_slots;
+    u32 m_hand { 0 };
+};
+
+struct TupleTable {
+    // indices of subroutines
+    IndexRange items;
+    u32 additional_items { invalid_index };
+};
+
+// anyOf/oneOf branches that all require the same property and restrict it to an enum.
+// Only the branches whose enum contains the value of an object instance can match.
+struct TaggedUnionTable {
+    // string index of the property name
+    u32 property { 0 };
+    // enum set of every tag value of the branches
+    u32 tags { 0 };
+    // offsets of the candidates of each tag, one more than there are tags, indices
+    IndexRange offsets;
+    // subroutines of the candidates, grouped by tag, indices
+    IndexRange candidates;
+    // subroutines of all branches, for instances that aren't objects, indices
+    IndexRange branches;
+    u32 stop_at_matches { 0 };
+};
+
+struct DependentRequiredTable {
+    // property table slot
+    u32 property { 0 };
+    // presence mask
+    IndexRange dependencies;
+};
+
+class Program {
+public:
+    Program();
+    ~Program();
+    Program(const Program&) = delete;
+    Program& operator=(const Program&) = delete;
+
+    // The flat tables are copied as they are, only the patterns are compiled again.
+    NonnullOwnPtr<Program> clone() const;
+
+    const Vector<Instruction>& code() const { return m_code; }
+    const Instruction& at(u32 pc) const { return m_code[pc]; }
+
+    const Subroutine& subroutine(u32 index) const { return m_subroutines[index]; }
+    const String& location(u32 subroutine) const { return m_strings[m_subroutines[subroutine].location]; }
+    size_t subroutine_count() const { return m_subroutines.size(); }
+
+    const NumberConstant& number(u32 index) const { return m_numbers[index]; }
+    const String& string(u32 index) const { return m_strings[index]; }
+    const EnumSet& enum_set(u32 index) const { return m_enum_sets[index]; }
+    const Pattern& pattern(u32 index) const { return m_patterns[index]; }
+    const RegexSet& pattern_set(u32 index) const { return m_pattern_sets[index]; }
+    u32 index(u32 index) const { return m_indices[index]; }
+
+    const PropertyTable& property_table(u32 index) const { return m_property_tables[index]; }
+    const PropertyEntry& property_entry(u32 index) const { return m_property_entries[index]; }
+    const PatternProperty& pattern_property(u32 index) const { return m_pattern_properties[index]; }
+    const TupleTable& tuple_table(u32 index) const { return m_tuple_tables[index]; }
+    const DependentRequiredTable& dependent_required_table(u32 index) const { return m_dependent_required_tables[index]; }
+    const TaggedUnionTable& tagged_union_table(u32 index) const { return m_tagged_union_tables[index]; }
+
+    // Property names used by the schema are interned as symbols, which are indices
+    // into the string pool. Returns invalid_index for names the schema doesn't use.
+    u32 symbol(const String& name) const
+    {
+        auto symbol = m_symbols.get(name);
+        return symbol.has_value() ? symbol.value() : invalid_index;
+    }
+
+    // Returns the slot of a property name in the table or invalid_index.
+    u32 find_property_slot(const PropertyTable& table, const String& name) const
+    {
+        if (!table.properties.count)
+            return invalid_index;
+
+        u64 hash = property_hash(name.characters(), name.length(), table.hash_seed);
+        u32 displacement = m_indices[table.displacements.first + property_bucket(hash, table.displacements.count)];
+        u32 slot = property_slot(hash, displacement, table.properties.count);
+        auto& entry = m_property_entries[table.properties.first + slot];
+        if (entry.name == invalid_index)
+            return invalid_index;
+
+        auto& entry_name = m_strings[entry.name];
+        if (entry_name.length() != name.length() || memcmp(entry_name.characters(), name.characters(), name.length()))
+            return invalid_index;
+        return slot;
+    }
+
+    // Keys repeat across the records of a stream and across documents, so their
+    // classifications are cached per property table for as long as the program lives.
+    // The caches are shared by every thread running the program, behind a lock.
+    bool find_key_classification(u32 table, const String& key, KeyClassification&) const;
+    void cache_key_classification(u32 table, const String& key, const KeyClassification&) const;
+
+    bool is_empty() const { return m_subroutines.is_empty(); }
+
+    void dump() const;
+
+private:
+    friend class Compiler;
+    friend class Optimizer;
+
+    template<typename T>
+    static u32 append(Vector<T>& vector, const T& value)
+    {
+        vector.append(value);
+        return vector.size() - 1;
+    }
+
+    u32 emit(OpCode opcode, u32 a = 0, u32 b = 0) { return append(m_code, { opcode, a, b }); }
+    u32 add_subroutine() { return append(m_subroutines, {}); }
+    u32 add_number(const NumberConstant& value) { return append(m_numbers, value); }
+    u32 add_string(const String& value) { return append(m_strings, value); }
+
+    u32 intern(const String& name)
+    {
+        u32 existing = symbol(name);
+        if (existing != invalid_index)
+            return existing;
+        u32 symbol = add_string(name);
+        m_symbols.set(name, symbol);
+        return symbol;
+    }
+    u32 add_enum_set(const EnumSet& set) { return append(m_enum_sets, set); }
+    u32 add_pattern_set(const RegexSet& set) { return append(m_pattern_sets, set); }
+    u32 add_index(u32 value) { return append(m_indices, value); }
+    u32 add_property_entry(const PropertyEntry& entry) { return append(m_property_entries, entry); }
+    u32 add_pattern_property(const PatternProperty& entry) { return append(m_pattern_properties, entry); }
+    u32 add_property_table(const PropertyTable& table) { return append(m_property_tables, table); }
+    u32 add_tuple_table(const TupleTable& table) { return append(m_tuple_tables, table); }
+    u32 add_dependent_required_table(const DependentRequiredTable& table) { return append(m_dependent_required_tables, table); }
+    u32 add_tagged_union_table(const TaggedUnionTable& table) { return append(m_tagged_union_tables, table); }
+
+    u32 add_pattern(const String& pattern)
+    {
+        m_patterns.append(make<Pattern>(pattern));
+        return m_patterns.size() - 1;
+    }
+
+    Vector<Instruction> m_code;
+    Vector<Subroutine> m_subroutines;
+
+    Vector<u32> m_indices;
+    Vector<PropertyEntry> m_property_entries;
+    Vector<PatternProperty> m_pattern_properties;
+    Vector<PropertyTable> m_property_tables;
+    Vector<TupleTable> m_tuple_tables;
+    Vector<DependentRequiredTable> m_dependent_required_tables;
+    Vector<TaggedUnionTable> m_tagged_union_tables;
+
+    Vector<NumberConstant> m_numbers;
+    Vector<String> m_strings;
+    HashMap<String, u32> m_symbols;
+    Vector<EnumSet> m_enum_sets;
+    NonnullOwnPtrVector<Pattern> m_patterns;
+    Vector<RegexSet> m_pattern_sets;
+
+    mutable pthread_mutex_t m_key_classifications_lock;
+    mutable Vector<KeyClassificationCache> m_key_classifications;
+};
+
+}
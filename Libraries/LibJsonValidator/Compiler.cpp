@@ -0,0 +1,621 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StdLibExtras.h>
+#include <LibJsonValidator/Compiler.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+#include <LibJsonValidator/Profile.h>
+
+namespace JsonValidator {
+
+NonnullOwnPtr<Program> Compiler::compile(const JsonSchemaNode& root)
+{
+    m_program = make<Program>();
+    m_subroutines.clear();
+    m_pending.clear();
+    m_errors.clear();
+
+    subroutine_for(root);
+
+    // subroutines are laid out depth first, so the code of a node ends up close to
+    // the code of its children.
+    while (!m_pending.is_empty()) {
+        auto pending = m_pending.take_last();
+        auto& subroutine = m_program->m_subroutines[pending.index];
+        subroutine.entry = m_program->m_code.size();
+        subroutine.location = m_program->add_string(pending.node->json_pointer());
+
+        compile_node(*pending.node);
+        m_program->emit(OpCode::Return);
+    }
+
+    check_for_cycles();
+
+#ifdef JSON_SCHEMA_DEBUG
+    m_program->dump();
+#endif
+
+    return m_program.release_nonnull();
+}
+
+// A subroutine that calls itself for the same instance, directly or through other
+// subroutines, never terminates. Recursion through child instances (items,
+// properties, ...) ends with the depth of the instance and is fine.
+void Compiler::check_for_cycles()
+{
+    Vector<u8> state;
+    for (size_t i = 0; i < m_program->subroutine_count(); ++i)
+        state.append(0);
+
+    for (u32 i = 0; i < m_program->subroutine_count(); ++i) {
+        if (!state[i] && visit_for_cycles(i, state))
+            return;
+    }
+}
+
+bool Compiler::visit_for_cycles(u32 subroutine, Vector<u8>& state)
+{
+    enum : u8 {
+        Unvisited,
+        OnStack,
+        Done,
+    };
+
+    state[subroutine] = OnStack;
+    for (u32 pc = m_program->subroutine(subroutine).entry; m_program->at(pc).opcode != OpCode::Return; ++pc) {
+        auto& insn = m_program->at(pc);
+        Vector<u32, 4> callees;
+        if (insn.opcode == OpCode::Call || insn.opcode == OpCode::CallBranch) {
+            callees.append(insn.a);
+        } else if (insn.opcode == OpCode::DependentSchema) {
+            callees.append(insn.b);
+        } else if (insn.opcode == OpCode::TaggedBranches) {
+            auto& table = m_program->tagged_union_table(insn.a);
+            for (u32 i = 0; i < table.branches.count; ++i)
+                callees.append(m_program->index(table.branches.first + i));
+        }
+
+        for (auto callee : callees) {
+            if (state[callee] == OnStack) {
+                m_errors.append(String::format("$ref cycle at %s does not lead to a child instance", m_program->location(callee).characters()));
+                return true;
+            }
+            if (state[callee] == Unvisited && visit_for_cycles(callee, state))
+                return true;
+        }
+    }
+    state[subroutine] = Done;
+    return false;
+}
+
+u32 Compiler::subroutine_for(const JsonSchemaNode& node)
+{
+    auto existing = m_subroutines.get(&node);
+    if (existing.has_value())
+        return existing.value();
+
+    u32 index = m_program->add_subroutine();
+    m_subroutines.set(&node, index);
+    m_pending.append({ index, &node });
+    return index;
+}
+
+void Compiler::add_property_hash(const Vector<PropertyEntry>& properties, PropertyTable& table)
+{
+    table.properties.first = m_program->m_property_entries.size();
+    table.displacements.first = m_program->m_indices.size();
+    if (properties.is_empty())
+        return;
+
+    u32 count = properties.size();
+    u32 bucket_count = max(1u, count / 4);
+    Vector<u32> slots;
+    Vector<u32> displacements;
+
+    // A minimal table is found quickly for all but very unlucky name sets, then
+    // the table gets a few empty slots. Names with equal hashes need another seed.
+    for (u32 seed = 0;; ++seed) {
+        for (u32 slot_count = count; slot_count <= 2 * count; slot_count += max(1u, count / 4)) {
+            if (build_property_hash(properties, seed, bucket_count, slot_count, slots, displacements)) {
+                table.hash_seed = seed;
+                table.properties.count = slot_count;
+                table.displacements.count = bucket_count;
+                for (auto property : slots)
+                    m_program->add_property_entry(property != invalid_index ? properties[property] : PropertyEntry { invalid_index, invalid_index });
+                for (auto displacement : displacements)
+                    m_program->add_index(displacement);
+                return;
+            }
+        }
+    }
+}
+
+bool Compiler::build_property_hash(const Vector<PropertyEntry>& properties, u32 seed, u32 bucket_count, u32 slot_count, Vector<u32>& slots, Vector<u32>& displacements)
+{
+    static const u32 max_displacement = 1 << 16;
+
+    Vector<u64> hashes;
+    Vector<Vector<u32>> buckets;
+    for (u32 i = 0; i < bucket_count; ++i)
+        buckets.append({});
+    for (u32 i = 0; i < properties.size(); ++i) {
+        auto& name = m_program->string(properties[i].name);
+        u64 hash = property_hash(name.characters(), name.length(), seed);
+        for (auto other : hashes) {
+            if (other == hash)
+                return false;
+        }
+        hashes.append(hash);
+        buckets[property_bucket(hash, bucket_count)].append(i);
+    }
+
+    // place the big buckets first, while most slots are still free
+    Vector<u32> order;
+    for (u32 i = 0; i < bucket_count; ++i)
+        order.append(i);
+    quick_sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    slots.clear();
+    for (u32 i = 0; i < slot_count; ++i)
+        slots.append(invalid_index);
+    displacements.clear();
+    for (u32 i = 0; i < bucket_count; ++i)
+        displacements.append(0);
+
+    Vector<u32> candidate;
+    for (auto bucket : order) {
+        if (buckets[bucket].is_empty())
+            break;
+
+        bool placed = false;
+        for (u32 displacement = 0; !placed && displacement < max_displacement; ++displacement) {
+            candidate.clear();
+            placed = true;
+            for (auto property : buckets[bucket]) {
+                u32 slot = property_slot(hashes[property], displacement, slot_count);
+                if (slots[slot] != invalid_index || candidate.contains_slow(slot)) {
+                    placed = false;
+                    break;
+                }
+                candidate.append(slot);
+            }
+            if (placed) {
+                for (size_t i = 0; i < candidate.size(); ++i)
+                    slots[candidate[i]] = buckets[bucket][i];
+                displacements[bucket] = displacement;
+            }
+        }
+        if (!placed)
+            return false;
+    }
+    return true;
+}
+
+// $ref and allOf are followed this deep when looking for the tag of a branch.
+static const size_t max_tag_search_depth = 8;
+static const size_t min_tagged_union_branches = 3;
+
+// The enum that restricts the instances of a node, also through $ref and allOf.
+static const EnumSet* find_enum(const JsonSchemaNode& node, size_t depth = 0)
+{
+    if (!node.enum_items().is_empty())
+        return &node.enum_items();
+    if (depth == max_tag_search_depth)
+        return nullptr;
+    for (auto& item : node.all_of()) {
+        if (auto* set = find_enum(item, depth + 1))
+            return set;
+    }
+    return node.reference() ? find_enum(*node.reference(), depth + 1) : nullptr;
+}
+
+// Calls back with every property that the node requires and restricts to an enum.
+template<typename Callback>
+static void for_each_tag(const JsonSchemaNode& node, Callback callback, size_t depth = 0)
+{
+    if (node.is_object()) {
+        auto& object = static_cast<const ObjectNode&>(node);
+        for (auto& name : object.required()) {
+            auto property = object.properties().find(name);
+            if (property == object.properties().end())
+                continue;
+            if (auto* set = find_enum(*property->value))
+                callback(name, *set);
+        }
+    }
+    if (depth == max_tag_search_depth)
+        return;
+    for (auto& item : node.all_of())
+        for_each_tag(item, callback, depth + 1);
+    if (node.reference())
+        for_each_tag(*node.reference(), callback, depth + 1);
+}
+
+static const EnumSet* find_tag(const JsonSchemaNode& node, const String& property)
+{
+    const EnumSet* found = nullptr;
+    for_each_tag(node, [&](auto& name, auto& set) {
+        if (!found && name == property)
+            found = &set;
+    });
+    return found;
+}
+
+// An object instance without the tag, or with a value outside the enum of a branch, fails
+// that branch. So for objects only the branches listing the value of the tag are run, which
+// keeps the outcome of anyOf and oneOf exactly the same.
+bool Compiler::compile_tagged_branches(const NonnullOwnPtrVector<JsonSchemaNode>& branches, const Vector<size_t>& order, u32 stop_at_matches)
+{
+    if (branches.size() < min_tagged_union_branches)
+        return false;
+
+    Vector<String> names;
+    for_each_tag(branches[0], [&](auto& name, auto&) {
+        names.append(name);
+    });
+    quick_sort(names.begin(), names.end(), [](auto& a, auto& b) { return strcmp(a.characters(), b.characters()) < 0; });
+
+    // the property that selects the fewest branches for its most common value
+    Optional<String> best;
+    size_t best_candidates = branches.size();
+    for (auto& name : names) {
+        EnumSet tags;
+        Vector<size_t> counts;
+        bool tags_every_branch = true;
+        for (auto& branch : branches) {
+            auto* set = find_tag(branch, name);
+            if (!set) {
+                tags_every_branch = false;
+                break;
+            }
+            for (auto& item : set->items()) {
+                auto index = tags.find(item);
+                if (!index.has_value()) {
+                    tags.add(item);
+                    counts.append(0);
+                    index = counts.size() - 1;
+                }
+                ++counts[index.value()];
+            }
+        }
+        if (!tags_every_branch)
+            continue;
+
+        size_t most = 0;
+        for (auto count : counts)
+            most = max(most, count);
+        if (most < best_candidates) {
+            best = name;
+            best_candidates = most;
+        }
+    }
+    if (!best.has_value())
+        return false;
+
+    EnumSet tags;
+    Vector<Vector<u32>> candidates;
+    TaggedUnionTable table;
+    table.property = m_program->intern(best.value());
+    table.stop_at_matches = stop_at_matches;
+    table.branches.first = m_program->m_indices.size();
+    table.branches.count = branches.size();
+    for (size_t i = 0; i < branches.size(); ++i) {
+        auto& branch = branches[order[i]];
+        u32 subroutine = subroutine_for(branch);
+        m_program->add_index(subroutine);
+        for (auto& item : find_tag(branch, best.value())->items()) {
+            auto index = tags.find(item);
+            if (!index.has_value()) {
+                tags.add(item);
+                candidates.append({});
+                index = candidates.size() - 1;
+            }
+            candidates[index.value()].append(subroutine);
+        }
+    }
+
+    table.tags = m_program->add_enum_set(tags);
+    table.offsets.first = m_program->m_indices.size();
+    table.offsets.count = candidates.size() + 1;
+    u32 offset = 0;
+    for (auto& group : candidates) {
+        m_program->add_index(offset);
+        offset += group.size();
+    }
+    m_program->add_index(offset);
+
+    table.candidates.first = m_program->m_indices.size();
+    table.candidates.count = offset;
+    for (auto& group : candidates) {
+        for (auto subroutine : group)
+            m_program->add_index(subroutine);
+    }
+
+    m_program->emit(OpCode::TaggedBranches, m_program->add_tagged_union_table(table));
+    return true;
+}
+
+void Compiler::compile_branches(const NonnullOwnPtrVector<JsonSchemaNode>& branches, u32 stop_at_matches, OpCode end_opcode)
+{
+    Vector<u32> jumps_to_end;
+
+    // Whether a branch matches doesn't depend on the order. The expected cost of the group
+    // is lowest if the branches with the lowest cost per match come first.
+    Vector<size_t> order;
+    Vector<double> cost_per_match;
+    for (size_t i = 0; i < branches.size(); ++i) {
+        order.append(i);
+        auto* statistics = m_profile ? m_profile->branch(branches[i].json_pointer()) : nullptr;
+        if (statistics && statistics->matches)
+            cost_per_match.append((double)statistics->cost / statistics->matches);
+        else
+            cost_per_match.append(__builtin_inf());
+    }
+    if (m_profile) {
+        quick_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (cost_per_match[a] != cost_per_match[b])
+                return cost_per_match[a] < cost_per_match[b];
+            return a < b;
+        });
+    }
+
+    m_program->emit(OpCode::BeginBranches);
+    if (compile_tagged_branches(branches, order, stop_at_matches)) {
+        m_program->emit(end_opcode);
+        return;
+    }
+
+    for (size_t i = 0; i < branches.size(); ++i) {
+        m_program->emit(OpCode::CallBranch, subroutine_for(branches[order[i]]));
+        if (stop_at_matches && i + 1 < branches.size())
+            jumps_to_end.append(m_program->emit(OpCode::JumpIfMatches, stop_at_matches));
+    }
+
+    u32 end = m_program->emit(end_opcode);
+    for (auto jump : jumps_to_end)
+        m_program->m_code[jump].b = end;
+}
+
+void Compiler::compile_node(const JsonSchemaNode& node)
+{
+    Vector<u32> jumps_to_end;
+
+    if (node.is_boolean()) {
+        auto& value = static_cast<const BooleanNode&>(node).value();
+        if (value.has_value()) {
+            if (!value.value())
+                m_program->emit(OpCode::Fail);
+            return;
+        }
+    }
+
+    if (node.accepted_types() != TypeMaskAny)
+        jumps_to_end.append(m_program->emit(OpCode::CheckType, node.accepted_types()));
+
+    if (node.JsonSchemaNode::required())
+        jumps_to_end.append(m_program->emit(OpCode::CheckPresent));
+
+    for (auto& item : node.all_of())
+        compile_node(item);
+
+    if (node.reference())
+        m_program->emit(OpCode::Call, subroutine_for(*node.reference()));
+
+    if (node.any_of().size())
+        compile_branches(node.any_of(), 1, OpCode::EndAnyOf);
+
+    if (node.get_not()) {
+        m_program->emit(OpCode::BeginBranches);
+        m_program->emit(OpCode::CallBranch, subroutine_for(*node.get_not()));
+        m_program->emit(OpCode::EndNot);
+    }
+
+    if (node.one_of().size())
+        compile_branches(node.one_of(), 2, OpCode::EndOneOf);
+
+    if (!node.enum_items().is_empty())
+        m_program->emit(OpCode::Enum, m_program->add_enum_set(node.enum_items()));
+    if (node.format().has_value())
+        m_program->emit(OpCode::Format, (u32)node.format().value());
+
+    if (node.is_string())
+        compile_string(static_cast<const StringNode&>(node), jumps_to_end);
+    else if (node.is_number())
+        compile_number(static_cast<const NumberNode&>(node), jumps_to_end);
+    else if (node.is_object())
+        compile_object(static_cast<const ObjectNode&>(node), jumps_to_end);
+    else if (node.is_array())
+        compile_array(static_cast<const ArrayNode&>(node), jumps_to_end);
+
+    u32 end = m_program->m_code.size();
+    for (auto jump : jumps_to_end)
+        m_program->m_code[jump].b = end;
+}
+
+void Compiler::emit_type_dispatch(const JsonSchemaNode& node, InstanceType type, Vector<u32>& jumps_to_end)
+{
+    // The keywords of a typed node only apply to instances of that type. If the
+    // type is asserted by CheckType already, a mismatch never gets this far.
+    TypeMask mask = type_mask_from_instance_type(type);
+    if (!(node.accepted_types() & ~mask))
+        return;
+
+    jumps_to_end.append(m_program->emit(OpCode::JumpIfNotType, mask));
+}
+
+void Compiler::compile_string(const StringNode& node, Vector<u32>& jumps_to_end)
+{
+    if (!node.pattern().has_value() && !node.max_length().has_value() && !node.min_length().has_value())
+        return;
+
+    emit_type_dispatch(node, InstanceType::String, jumps_to_end);
+
+    if (node.pattern().has_value())
+        m_program->emit(OpCode::Pattern, m_program->add_pattern(node.pattern().value()));
+    if (node.max_length().has_value())
+        m_program->emit(OpCode::MaxLength, node.max_length().value());
+    if (node.min_length().has_value())
+        m_program->emit(OpCode::MinLength, node.min_length().value());
+}
+
+void Compiler::compile_number(const NumberNode& node, Vector<u32>& jumps_to_end)
+{
+    emit_type_dispatch(node, InstanceType::Number, jumps_to_end);
+
+    if (node.minimum().has_value())
+        m_program->emit(OpCode::Minimum, m_program->add_number(node.minimum().value()));
+    if (node.maximum().has_value())
+        m_program->emit(OpCode::Maximum, m_program->add_number(node.maximum().value()));
+    if (node.exclusive_minimum().has_value())
+        m_program->emit(OpCode::ExclusiveMinimum, m_program->add_number(node.exclusive_minimum().value()));
+    if (node.exclusive_maximum().has_value())
+        m_program->emit(OpCode::ExclusiveMaximum, m_program->add_number(node.exclusive_maximum().value()));
+    if (node.multiple_of().has_value())
+        m_program->emit(OpCode::MultipleOf, m_program->add_number(node.multiple_of().value()));
+}
+
+void Compiler::compile_object(const ObjectNode& node, Vector<u32>& jumps_to_end)
+{
+    emit_type_dispatch(node, InstanceType::Object, jumps_to_end);
+
+    if (node.min_properties())
+        m_program->emit(OpCode::MinProperties, node.min_properties());
+    if (node.max_properties().has_value())
+        m_program->emit(OpCode::MaxProperties, node.max_properties().value());
+
+    for (auto& dependent_schema : node.dependent_schemas())
+        m_program->emit(OpCode::DependentSchema, m_program->intern(dependent_schema.key), subroutine_for(*dependent_schema.value));
+
+    // Names that are only required get a slot too, the member scan of Properties marks
+    // every name it finds in a presence mask and the required checks are done on that.
+    Vector<PropertyEntry> properties;
+    HashMap<u32, size_t> entry_of_symbol;
+    auto add_name = [&](const String& name, u32 subroutine) {
+        u32 symbol = m_program->intern(name);
+        auto entry = entry_of_symbol.get(symbol);
+        if (!entry.has_value()) {
+            entry_of_symbol.set(symbol, properties.size());
+            properties.append({ symbol, subroutine });
+        } else if (subroutine != invalid_index) {
+            properties[entry.value()].subroutine = subroutine;
+        }
+    };
+    for (auto& property : node.properties())
+        add_name(property.key, subroutine_for(*property.value));
+    for (auto& required : node.required())
+        add_name(required, invalid_index);
+    for (auto& dependent_required : node.dependent_required()) {
+        add_name(dependent_required.key, invalid_index);
+        for (auto& dependency : dependent_required.value)
+            add_name(dependency, invalid_index);
+    }
+
+    PropertyTable table;
+    add_property_hash(properties, table);
+
+    HashMap<u32, u32> slot_of_symbol;
+    for (u32 slot = 0; slot < table.properties.count; ++slot) {
+        auto& entry = m_program->property_entry(table.properties.first + slot);
+        if (entry.name != invalid_index)
+            slot_of_symbol.set(entry.name, slot);
+    }
+    auto add_presence_mask = [&](const HashTable<String>& names) {
+        Vector<u32> mask;
+        for (u32 i = 0; i < presence_words(table); ++i)
+            mask.append(0);
+        for (auto& name : names) {
+            u32 slot = slot_of_symbol.get(m_program->intern(name)).value();
+            mask[slot / 32] |= 1u << (slot % 32);
+        }
+        IndexRange range { (u32)m_program->m_indices.size(), (u32)mask.size() };
+        for (auto word : mask)
+            m_program->add_index(word);
+        return range;
+    };
+
+    if (!node.required().is_empty())
+        table.required = add_presence_mask(node.required());
+    table.dependent_required.first = m_program->m_dependent_required_tables.size();
+    table.dependent_required.count = node.dependent_required().size();
+    for (auto& dependent_required : node.dependent_required()) {
+        DependentRequiredTable dependent_table;
+        dependent_table.property = slot_of_symbol.get(m_program->intern(dependent_required.key)).value();
+        dependent_table.dependencies = add_presence_mask(dependent_required.value);
+        m_program->add_dependent_required_table(dependent_table);
+    }
+
+    table.pattern_properties.first = m_program->m_pattern_properties.size();
+    table.pattern_properties.count = node.pattern_properties().size();
+    if (!node.pattern_properties().is_empty()) {
+        Vector<String> patterns;
+        for (auto& pattern_property : node.pattern_properties()) {
+            patterns.append(pattern_property.pattern());
+            m_program->add_pattern_property({ m_program->add_string(pattern_property.pattern()), subroutine_for(pattern_property) });
+        }
+        table.pattern_set = m_program->add_pattern_set(RegexSet(patterns));
+    }
+
+    if (node.additional_properties())
+        table.additional_properties = subroutine_for(*node.additional_properties());
+    if (node.property_names())
+        table.property_names = subroutine_for(*node.property_names());
+
+    m_program->emit(OpCode::Properties, m_program->add_property_table(table));
+}
+
+void Compiler::compile_array(const ArrayNode& node, Vector<u32>& jumps_to_end)
+{
+    emit_type_dispatch(node, InstanceType::Array, jumps_to_end);
+
+    if (node.min_items())
+        jumps_to_end.append(m_program->emit(OpCode::MinItems, node.min_items()));
+    if (node.max_items().has_value())
+        jumps_to_end.append(m_program->emit(OpCode::MaxItems, node.max_items().value()));
+
+    if (node.unique_items())
+        m_program->emit(OpCode::UniqueItems);
+
+    if (node.items_is_array()) {
+        TupleTable table;
+        table.items.first = m_program->m_indices.size();
+        table.items.count = node.items().size();
+        for (auto& item : node.items())
+            m_program->add_index(subroutine_for(item));
+        if (node.additional_items())
+            table.additional_items = subroutine_for(*node.additional_items());
+        m_program->emit(OpCode::TupleItems, m_program->add_tuple_table(table));
+    } else if (node.items().size()) {
+        m_program->emit(OpCode::Items, subroutine_for(node.items().at(0)));
+    }
+
+    if (node.contains())
+        m_program->emit(OpCode::Contains, subroutine_for(*node.contains()));
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+#include <LibJsonValidator/Bytecode.h>
+#include <LibJsonValidator/Forward.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+
+namespace JsonValidator {
+
+// Lowers a parsed and resolved JsonSchemaNode tree into a flat Program.
+// Every node that is entered on its own (the root, $ref targets, branches of
+// anyOf/oneOf/not and all nodes applied to child instances) becomes a
+// subroutine, allOf children are inlined into their parent.
+class Compiler {
+public:
+    Compiler() = default;
+    ~Compiler() = default;
+    Compiler(const Compiler& other) = delete;
+    Compiler& operator=(const Compiler& other) = delete;
+
+    NonnullOwnPtr<Program> compile(const JsonSchemaNode& root);
+
+    // Branches of anyOf and oneOf are tried in the order of the profile, if there is one.
+    void set_profile(const Profile* profile) { m_profile = profile; }
+
+    // Schemas the compiled program can't validate with, e.g. $ref cycles.
+    const Vector<String>& errors() const { return m_errors; }
+
+private:
+    u32 subroutine_for(const JsonSchemaNode&);
+    void check_for_cycles();
+    void add_property_hash(const Vector<PropertyEntry>&, PropertyTable&);
+    bool build_property_hash(const Vector<PropertyEntry>&, u32 seed, u32 bucket_count, u32 slot_count, Vector<u32>& slots, Vector<u32>& displacements);
+    bool visit_for_cycles(u32 subroutine, Vector<u8>& state);
+    void compile_node(const JsonSchemaNode&);
+    void compile_branches(const NonnullOwnPtrVector<JsonSchemaNode>&, u32 stop_at_matches, OpCode end_opcode);
+    // Emits TaggedBranches if the branches form a tagged union, `order` is the order to try them in.
+    bool compile_tagged_branches(const NonnullOwnPtrVector<JsonSchemaNode>&, const Vector<size_t>& order, u32 stop_at_matches);
+
+    void emit_type_dispatch(const JsonSchemaNode&, InstanceType, Vector<u32>& jumps_to_end);
+    void compile_string(const StringNode&, Vector<u32>& jumps_to_end);
+    void compile_number(const NumberNode&, Vector<u32>& jumps_to_end);
+    void compile_object(const ObjectNode&, Vector<u32>& jumps_to_end);
+    void compile_array(const ArrayNode&, Vector<u32>& jumps_to_end);
+
+    struct PendingSubroutine {
+        u32 index;
+        const JsonSchemaNode* node;
+    };
+
+    OwnPtr<Program> m_program;
+    HashMap<const JsonSchemaNode*, u32> m_subroutines;
+    Vector<PendingSubroutine> m_pending;
+    Vector<String> m_errors;
+    const Profile* m_profile { nullptr };
+};
+
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/HashFunctions.h>
+#include <AK/StdLibExtras.h>
+#include <LibJsonValidator/EnumSet.h>
+#include <string.h>
+
+namespace JsonValidator {
+
+u32 structural_hash(const JsonValue& json)
+{
+    if (json.is_string())
+        return json.as_string().hash();
+
+    if (json.is_number()) {
+        double number = json.to_number<double>();
+        // -0.0 equals 0.0
+        if (number == 0)
+            number = 0;
+        u64 bits;
+        memcpy(&bits, &number, sizeof(bits));
+        return pair_int_hash(1, u64_hash(bits));
+    }
+
+    if (json.is_array()) {
+        u32 hash = 2;
+        for (auto& value : json.as_array().values())
+            hash = pair_int_hash(hash, structural_hash(value));
+        return hash;
+    }
+
+    if (json.is_object()) {
+        u32 hash = 3;
+        json.as_object().for_each_member([&](auto& key, auto& value) {
+            hash += pair_int_hash(key.hash(), structural_hash(value));
+        });
+        return hash;
+    }
+
+    if (json.is_bool())
+        return json.as_bool() ? 4 : 5;
+    return 6;
+}
+
+EnumSet::EnumSet(const JsonArray& items)
+{
+    for (auto& item : items.values())
+        add(item);
+}
+
+u32 EnumSet::find_slot(const JsonValue& json, u32 hash) const
+{
+    u32 mask = m_slots.size() - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask) {
+        u32 item = m_slots[slot];
+        if (item == empty_slot)
+            return slot;
+        if (m_hashes[item] != hash)
+            continue;
+        if (m_strings_only ? m_items[item].as_string() == json.as_string() : m_items[item].equals(json))
+            return slot;
+    }
+}
+
+void EnumSet::grow()
+{
+    size_t capacity = max<size_t>(8, m_slots.size() * 2);
+    m_slots.clear();
+    m_slots.ensure_capacity(capacity);
+    for (size_t i = 0; i < capacity; ++i)
+        m_slots.append(empty_slot);
+
+    for (u32 item = 0; item < m_items.size(); ++item) {
+        u32 mask = m_slots.size() - 1;
+        u32 slot = m_hashes[item] & mask;
+        while (m_slots[slot] != empty_slot)
+            slot = (slot + 1) & mask;
+        m_slots[slot] = item;
+    }
+}
+
+bool EnumSet::add(const JsonValue& json)
+{
+    // at most half full
+    if ((m_items.size() + 1) * 2 > m_slots.size())
+        grow();
+
+    // from now on items are compared with equals(), the hashes stay the same
+    if (!json.is_string())
+        m_strings_only = false;
+
+    u32 hash = structural_hash(json);
+    u32 slot = find_slot(json, hash);
+    if (m_slots[slot] != empty_slot)
+        return false;
+
+    m_slots[slot] = m_items.size();
+    m_items.append(json);
+    m_hashes.append(hash);
+    return true;
+}
+
+bool EnumSet::contains(const JsonValue& json) const
+{
+    if (m_items.is_empty())
+        return false;
+    if (m_strings_only && !json.is_string())
+        return false;
+
+    u32 hash = structural_hash(json);
+    return m_slots[find_slot(json, hash)] != empty_slot;
+}
+
+Optional<u32> EnumSet::find(const JsonValue& json) const
+{
+    if (m_items.is_empty())
+        return {};
+    if (m_strings_only && !json.is_string())
+        return {};
+
+    u32 item = m_slots[find_slot(json, structural_hash(json))];
+    if (item == empty_slot)
+        return {};
+    return item;
+}
+
+}
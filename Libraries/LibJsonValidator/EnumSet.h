@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/JsonValue.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+
+namespace JsonValidator {
+
+// A hash that agrees with JsonValue::equals(): numbers hash by their double value, so
+// 1 and 1.0 hash the same, and object members are combined independent of their order.
+u32 structural_hash(const JsonValue&);
+
+// The values of an enum or const keyword, in an open addressing hash table keyed by
+// structural_hash(). Sets of strings only compare strings.
+class EnumSet {
+public:
+    EnumSet() = default;
+    explicit EnumSet(const JsonArray& items);
+
+    // Returns false if an equal value is already in the set.
+    bool add(const JsonValue&);
+    bool contains(const JsonValue&) const;
+    // Returns the index of an equal item, items keep the order they were added in.
+    Optional<u32> find(const JsonValue&) const;
+
+    const Vector<JsonValue>& items() const { return m_items; }
+    size_t size() const { return m_items.size(); }
+    bool is_empty() const { return m_items.is_empty(); }
+    bool is_strings_only() const { return m_strings_only; }
+
+private:
+    static const u32 empty_slot = 0xffffffff;
+
+    // Returns the slot of an equal item or the empty slot where it would go.
+    u32 find_slot(const JsonValue&, u32 hash) const;
+    void grow();
+
+    Vector<JsonValue> m_items;
+    Vector<u32> m_hashes;
+    // indices into m_items, the size is a power of two
+    Vector<u32> m_slots;
+    bool m_strings_only { true };
+};
+
+}
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <LibJsonValidator/Format.h>
+#include <string.h>
+
+namespace JsonValidator {
+
+Optional<Format> format_from_string(const String& value)
+{
+#define __ENUMERATE_FORMAT(name, keyword) \
+    if (value == keyword)                 \
+        return Format::name;
+    ENUMERATE_FORMATS
+#undef __ENUMERATE_FORMAT
+    return {};
+}
+
+const char* to_string(Format format)
+{
+    switch (format) {
+#define __ENUMERATE_FORMAT(name, keyword) \
+    case Format::name:                    \
+        return keyword;
+        ENUMERATE_FORMATS
+#undef __ENUMERATE_FORMAT
+    }
+    return "";
+}
+
+const char* format_enumerator_name(Format format)
+{
+    switch (format) {
+#define __ENUMERATE_FORMAT(name, keyword) \
+    case Format::name:                    \
+        return #name;
+        ENUMERATE_FORMATS
+#undef __ENUMERATE_FORMAT
+    }
+    return "";
+}
+
+// Each byte maps to the set of character classes it belongs to, so a class test is one load.
+enum CharacterClass : u8 {
+    Digit = 1 << 0,
+    HexDigit = 1 << 1,
+    Alpha = 1 << 2,
+    // RFC 3986 unreserved and sub-delims
+    Unreserved = 1 << 3,
+    SubDelim = 1 << 4,
+    // RFC 5322 atext
+    AText = 1 << 5,
+};
+
+struct CharacterClassTable {
+    u8 classes[256];
+};
+
+static constexpr CharacterClassTable make_character_class_table()
+{
+    CharacterClassTable table {};
+    auto add = [&](const char* characters, u8 character_class) {
+        for (; *characters; ++characters)
+            table.classes[(u8)*characters] |= character_class;
+    };
+    for (int ch = '0'; ch <= '9'; ++ch)
+        table.classes[ch] |= Digit | HexDigit | Unreserved | AText;
+    for (int ch = 'a'; ch <= 'z'; ++ch)
+        table.classes[ch] |= Alpha | Unreserved | AText;
+    for (int ch = 'A'; ch <= 'Z'; ++ch)
+        table.classes[ch] |= Alpha | Unreserved | AText;
+    add("abcdefABCDEF", HexDigit);
+    add("-._~", Unreserved);
+    add("!$&'()*+,;=", SubDelim);
+    add("!#$%&'*+-/=?^_`{|}~", AText);
+    return table;
+}
+
+static constexpr CharacterClassTable s_character_classes = make_character_class_table();
+
+static inline bool is_class(char ch, u8 character_class)
+{
+    return s_character_classes.classes[(u8)ch] & character_class;
+}
+
+static bool parse_digits(const char* characters, size_t count, unsigned& value)
+{
+    value = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!is_class(characters[i], Digit))
+            return false;
+        value = value * 10 + (unsigned)(characters[i] - '0');
+    }
+    return true;
+}
+
+static bool is_leap_year(unsigned year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// RFC 3339 full-date: YYYY-MM-DD
+bool is_valid_date(const char* characters, size_t length)
+{
+    static const unsigned days_in_month[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+    if (length != 10 || characters[4] != '-' || characters[7] != '-')
+        return false;
+
+    unsigned year, month, day;
+    if (!parse_digits(characters, 4, year) || !parse_digits(characters + 5, 2, month) || !parse_digits(characters + 8, 2, day))
+        return false;
+    if (month < 1 || month > 12 || day < 1)
+        return false;
+    if (month == 2 && is_leap_year(year))
+        return day <= 29;
+    return day <= days_in_month[month - 1];
+}
+
+// RFC 3339 full-time: HH:MM:SS[.fraction](Z|+HH:MM|-HH:MM). A leap second has to
+// fall on 23:59:60 in UTC.
+bool is_valid_time(const char* characters, size_t length)
+{
+    if (length < 9 || characters[2] != ':' || characters[5] != ':')
+        return false;
+
+    unsigned hour, minute, second;
+    if (!parse_digits(characters, 2, hour) || !parse_digits(characters + 3, 2, minute) || !parse_digits(characters + 6, 2, second))
+        return false;
+    if (hour > 23 || minute > 59 || second > 60)
+        return false;
+
+    size_t i = 8;
+    if (characters[i] == '.') {
+        size_t fraction_start = ++i;
+        while (i < length && is_class(characters[i], Digit))
+            ++i;
+        if (i == fraction_start)
+            return false;
+    }
+
+    int offset_minutes = 0;
+    if (i + 1 == length && (characters[i] == 'Z' || characters[i] == 'z')) {
+        // UTC
+    } else if (i + 6 == length && (characters[i] == '+' || characters[i] == '-') && characters[i + 3] == ':') {
+        unsigned offset_hour, offset_minute;
+        if (!parse_digits(characters + i + 1, 2, offset_hour) || !parse_digits(characters + i + 4, 2, offset_minute))
+            return false;
+        if (offset_hour > 23 || offset_minute > 59)
+            return false;
+        offset_minutes = (int)(offset_hour * 60 + offset_minute);
+        if (characters[i] == '-')
+            offset_minutes = -offset_minutes;
+    } else {
+        return false;
+    }
+
+    if (second == 60) {
+        int utc_minutes = ((int)(hour * 60 + minute) - offset_minutes + 24 * 60) % (24 * 60);
+        return utc_minutes == 23 * 60 + 59;
+    }
+    return true;
+}
+
+bool is_valid_date_time(const char* characters, size_t length)
+{
+    if (length < 11 || (characters[10] != 'T' && characters[10] != 't'))
+        return false;
+    return is_valid_date(characters, 10) && is_valid_time(characters + 11, length - 11);
+}
+
+// Dotted decimal without leading zeros.
+bool is_valid_ipv4(const char* characters, size_t length)
+{
+    size_t i = 0;
+    for (int octet = 0; octet < 4; ++octet) {
+        if (octet > 0) {
+            if (i == length || characters[i] != '.')
+                return false;
+            ++i;
+        }
+        size_t start = i;
+        unsigned value = 0;
+        while (i < length && i - start < 3 && is_class(characters[i], Digit))
+            value = value * 10 + (unsigned)(characters[i++] - '0');
+        if (i == start || value > 255 || (characters[start] == '0' && i - start > 1))
+            return false;
+    }
+    return i == length;
+}
+
+// RFC 4291 text form: eight groups of up to four hex digits, one "::" standing in for at
+// least one zero group, and an optional dotted IPv4 address in the last 32 bits.
+bool is_valid_ipv6(const char* characters, size_t length)
+{
+    size_t i = 0;
+    unsigned groups = 0;
+    bool compressed = false;
+
+    if (length >= 2 && characters[0] == ':' && characters[1] == ':') {
+        compressed = true;
+        i = 2;
+    }
+
+    while (i < length) {
+        size_t start = i;
+        bool dotted = false;
+        while (i < length && characters[i] != ':') {
+            if (characters[i] == '.')
+                dotted = true;
+            else if (!is_class(characters[i], HexDigit))
+                return false;
+            ++i;
+        }
+
+        if (dotted) {
+            if (i != length || groups > 6 || !is_valid_ipv4(characters + start, i - start))
+                return false;
+            groups += 2;
+            break;
+        }
+        if (i == start || i - start > 4)
+            return false;
+        ++groups;
+
+        if (i == length)
+            break;
+        if (i + 1 < length && characters[i + 1] == ':') {
+            if (compressed)
+                return false;
+            compressed = true;
+            i += 2;
+            continue;
+        }
+        if (++i == length)
+            return false;
+    }
+
+    return compressed ? groups <= 7 : groups == 8;
+}
+
+// RFC 4122: 8-4-4-4-12 hex digits
+bool is_valid_uuid(const char* characters, size_t length)
+{
+    if (length != 36)
+        return false;
+    for (size_t i = 0; i < length; ++i) {
+        if (i == 8 || i == 13 || i == 18 || i == 23) {
+            if (characters[i] != '-')
+                return false;
+        } else if (!is_class(characters[i], HexDigit)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// RFC 1123: dot separated labels of letters, digits and hyphens, at most 63 bytes each and
+// 253 in total. Labels don't start or end with a hyphen.
+bool is_valid_hostname(const char* characters, size_t length)
+{
+    if (length == 0 || length > 253)
+        return false;
+
+    size_t label_start = 0;
+    for (size_t i = 0; i <= length; ++i) {
+        if (i < length && characters[i] != '.') {
+            if (!is_class(characters[i], Digit | Alpha) && characters[i] != '-')
+                return false;
+            continue;
+        }
+        size_t label_length = i - label_start;
+        if (label_length == 0 || label_length > 63)
+            return false;
+        if (characters[label_start] == '-' || characters[i - 1] == '-')
+            return false;
+        label_start = i + 1;
+    }
+    return true;
+}
+
+// RFC 5321 mailbox: a dot-atom or quoted local part, then a hostname or an address literal.
+bool is_valid_email(const char* characters, size_t length)
+{
+    size_t i = 0;
+    if (length && characters[0] == '"') {
+        for (i = 1; i < length && characters[i] != '"'; ++i) {
+            if (characters[i] == '\\' && ++i == length)
+                return false;
+        }
+        if (i++ == length)
+            return false;
+    } else {
+        for (; i < length && characters[i] != '@'; ++i) {
+            if (characters[i] == '.') {
+                if (i == 0 || characters[i - 1] == '.')
+                    return false;
+            } else if (!is_class(characters[i], AText)) {
+                return false;
+            }
+        }
+        if (i == 0 || i > 64 || characters[i - 1] == '.')
+            return false;
+    }
+
+    if (i == length || characters[i] != '@')
+        return false;
+    const char* domain = characters + i + 1;
+    size_t domain_length = length - i - 1;
+
+    if (domain_length >= 2 && domain[0] == '[' && domain[domain_length - 1] == ']') {
+        if (domain_length > 7 && !memcmp(domain + 1, "IPv6:", 5))
+            return is_valid_ipv6(domain + 6, domain_length - 7);
+        return is_valid_ipv4(domain + 1, domain_length - 2);
+    }
+    return is_valid_hostname(domain, domain_length);
+}
+
+// Consumes characters of the given classes, the extra characters and percent-encoded bytes.
+static size_t scan_uri_characters(const char* characters, size_t length, size_t i, u8 classes, const char* extra)
+{
+    while (i < length) {
+        char ch = characters[i];
+        if (ch == '%') {
+            if (i + 2 >= length || !is_class(characters[i + 1], HexDigit) || !is_class(characters[i + 2], HexDigit))
+                return i;
+            i += 3;
+        } else if (is_class(ch, classes) || (ch && strchr(extra, ch))) {
+            ++i;
+        } else {
+            return i;
+        }
+    }
+    return i;
+}
+
+static bool is_valid_uri_authority(const char* characters, size_t length)
+{
+    const u8 reg_name = Unreserved | SubDelim;
+
+    size_t host_start = 0;
+    for (size_t i = 0; i < length; ++i) {
+        if (characters[i] == '@') {
+            if (scan_uri_characters(characters, i, 0, reg_name, ":") != i)
+                return false;
+            host_start = i + 1;
+            break;
+        }
+    }
+
+    size_t i = host_start;
+    if (i < length && characters[i] == '[') {
+        size_t end = i;
+        while (end < length && characters[end] != ']')
+            ++end;
+        if (end == length || !is_valid_ipv6(characters + i + 1, end - i - 1))
+            return false;
+        i = end + 1;
+    } else {
+        i = scan_uri_characters(characters, length, i, reg_name, "");
+    }
+
+    if (i < length && characters[i] == ':') {
+        ++i;
+        while (i < length && is_class(characters[i], Digit))
+            ++i;
+    }
+    return i == length;
+}
+
+// RFC 3986 URI: an absolute reference with a scheme and an optional fragment.
+bool is_valid_uri(const char* characters, size_t length)
+{
+    const u8 pchar = Unreserved | SubDelim;
+
+    if (length == 0 || !is_class(characters[0], Alpha))
+        return false;
+    size_t i = 1;
+    while (i < length && (is_class(characters[i], Alpha | Digit) || characters[i] == '+' || characters[i] == '-' || characters[i] == '.'))
+        ++i;
+    if (i == length || characters[i] != ':')
+        return false;
+    ++i;
+
+    if (i + 1 < length && characters[i] == '/' && characters[i + 1] == '/') {
+        size_t start = i + 2;
+        size_t end = start;
+        while (end < length && characters[end] != '/' && characters[end] != '?' && characters[end] != '#')
+            ++end;
+        if (!is_valid_uri_authority(characters + start, end - start))
+            return false;
+        i = end;
+    }
+
+    i = scan_uri_characters(characters, length, i, pchar, ":@/");
+    if (i < length && characters[i] == '?')
+        i = scan_uri_characters(characters, length, i + 1, pchar, ":@/?");
+    if (i < length && characters[i] == '#')
+        i = scan_uri_characters(characters, length, i + 1, pchar, ":@/?");
+    return i == length;
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+
+namespace JsonValidator {
+
+#define ENUMERATE_FORMATS                     \
+    __ENUMERATE_FORMAT(DateTime, "date-time") \
+    __ENUMERATE_FORMAT(Date, "date")          \
+    __ENUMERATE_FORMAT(Time, "time")          \
+    __ENUMERATE_FORMAT(IPv4, "ipv4")          \
+    __ENUMERATE_FORMAT(IPv6, "ipv6")          \
+    __ENUMERATE_FORMAT(UUID, "uuid")          \
+    __ENUMERATE_FORMAT(Email, "email")        \
+    __ENUMERATE_FORMAT(Hostname, "hostname")  \
+    __ENUMERATE_FORMAT(URI, "uri")
+
+// The formats asserted when the parser is asked to. Others stay annotations.
+enum class Format : u8 {
+#define __ENUMERATE_FORMAT(name, keyword) name,
+    ENUMERATE_FORMATS
+#undef __ENUMERATE_FORMAT
+};
+
+Optional<Format> format_from_string(const String&);
+// The value of the format keyword.
+const char* to_string(Format);
+// The enumerator name, for generated code.
+const char* format_enumerator_name(Format);
+
+// The checks scan the bytes once and don't allocate.
+bool is_valid_date_time(const char*, size_t);
+bool is_valid_date(const char*, size_t);
+bool is_valid_time(const char*, size_t);
+bool is_valid_ipv4(const char*, size_t);
+bool is_valid_ipv6(const char*, size_t);
+bool is_valid_uuid(const char*, size_t);
+bool is_valid_email(const char*, size_t);
+bool is_valid_hostname(const char*, size_t);
+bool is_valid_uri(const char*, size_t);
+
+inline bool matches_format(Format format, const String& value)
+{
+    const char* characters = value.characters();
+    size_t length = value.length();
+    switch (format) {
+    case Format::DateTime:
+        return is_valid_date_time(characters, length);
+    case Format::Date:
+        return is_valid_date(characters, length);
+    case Format::Time:
+        return is_valid_time(characters, length);
+    case Format::IPv4:
+        return is_valid_ipv4(characters, length);
+    case Format::IPv6:
+        return is_valid_ipv6(characters, length);
+    case Format::UUID:
+        return is_valid_uuid(characters, length);
+    case Format::Email:
+        return is_valid_email(characters, length);
+    case Format::Hostname:
+        return is_valid_hostname(characters, length);
+    case Format::URI:
+        return is_valid_uri(characters, length);
+    }
+    return true;
+}
+
+}
@@ -28,8 +28,23 @@
 
 namespace JsonValidator {
 
+class ArrayNode;
+class BooleanNode;
+class Compiler;
+class EnumSet;
+class Interpreter;
 class JsonSchemaNode;
-class Validator;
+class NullNode;
+class NumberNode;
+class ObjectNode;
+class Optimizer;
 class Parser;
+class Profile;
+class Program;
+class StreamingValidator;
+class StringNode;
+class Tokenizer;
+class UndefinedNode;
+class Validator;
 
 }
@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibJsonValidator/Generator.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+#include <LibJsonValidator/Validator.h>
+
+namespace JsonValidator {
+
+static String string_literal(const String& string)
+{
+    StringBuilder b;
+    b.append('"');
+    for (size_t i = 0; i < string.length(); ++i) {
+        u8 ch = string[i];
+        if (ch == '"' || ch == '\\') {
+            b.append('\\');
+            b.append(ch);
+        } else if (ch < 0x20 || ch >= 0x7f || ch == '?') {
+            // octal escapes never swallow the following character
+            b.appendf("\\%03o", ch);
+        } else {
+            b.append(ch);
+        }
+    }
+    b.append('"');
+    return b.build();
+}
+
+static String number_literal(double value)
+{
+    StringBuilder b;
+    b.appendf("%.17g", value);
+    auto literal = b.build();
+    if (!literal.contains(".") && !literal.contains("e") && !literal.contains("n") && !literal.contains("i"))
+        return String::format("%s.0", literal.characters());
+    return literal;
+}
+
+static String integer_literal(i64 value)
+{
+    // -9223372036854775808 would be the negation of a literal that doesn't fit
+    if (value == INT64_MIN)
+        return "(-9223372036854775807LL - 1)";
+    return String::format("%lldLL", (long long)value);
+}
+
+static String type_predicate(TypeMask mask)
+{
+    return String::format("(JsonValidator::type_mask_of(json) & 0x%02x)", mask);
+}
+
+void Generator::generate_preamble(StringBuilder& b)
+{
+    b.append("// Generated by jsonvalidator-generate, do not edit.\n\n");
+    b.append("#include <AK/JsonArray.h>\n");
+    b.append("#include <AK/JsonObject.h>\n");
+    b.append("#include <AK/JsonValue.h>\n");
+    b.append("#include <LibJsonValidator/EnumSet.h>\n");
+    b.append("#include <LibJsonValidator/Format.h>\n");
+    b.append("#include <LibJsonValidator/Keywords.h>\n");
+    b.append("#include <LibJsonValidator/NumberConstant.h>\n");
+    b.append("#include <LibJsonValidator/Pattern.h>\n");
+    b.append("#include <LibJsonValidator/Validator.h>\n");
+}
+
+String Generator::subroutine_name(u32 subroutine) const
+{
+    return String::format("%s_sub%u", m_function_name.characters(), subroutine);
+}
+
+void Generator::generate(StringBuilder& b)
+{
+    m_statics.clear();
+    m_static_count = 0;
+
+    StringBuilder functions;
+    for (u32 i = 0; i < m_program.subroutine_count(); ++i)
+        generate_subroutine(functions, i);
+
+    b.append("\n");
+    for (u32 i = 0; i < m_program.subroutine_count(); ++i)
+        b.appendf("static bool %s(const JsonValue&, JsonValidator::ValidationError*);\n", subroutine_name(i).characters());
+    b.append(m_statics.to_string());
+    b.append(functions.to_string());
+
+    b.appendf("\nbool %s(const JsonValue& json, JsonValidator::ValidationError& e)\n{\n", m_function_name.characters());
+    if (m_program.is_empty())
+        b.append("    (void)json;\n    (void)e;\n    return false;\n}\n");
+    else
+        b.appendf("    return %s(json, &e);\n}\n", subroutine_name(0).characters());
+
+    b.appendf("\nbool %s(const JsonValue& json)\n{\n", m_function_name.characters());
+    if (m_program.is_empty())
+        b.append("    (void)json;\n    return false;\n}\n");
+    else
+        b.appendf("    return %s(json, nullptr);\n}\n", subroutine_name(0).characters());
+}
+
+void Generator::generate_subroutine(StringBuilder& b, u32 subroutine)
+{
+    auto& code = m_program.code();
+    auto& location = m_program.location(subroutine);
+
+    u32 entry = m_program.subroutine(subroutine).entry;
+    u32 end = entry;
+    while (code[end].opcode != OpCode::Return)
+        ++end;
+
+    HashTable<u32> labels;
+    bool uses_matches = false;
+    for (u32 pc = entry; pc <= end; ++pc) {
+        if (is_jump(code[pc].opcode))
+            labels.set(code[pc].b);
+        if (code[pc].opcode == OpCode::BeginBranches)
+            uses_matches = true;
+    }
+
+    b.appendf("\nstatic bool %s(const JsonValue& json, JsonValidator::ValidationError* e)\n{\n", subroutine_name(subroutine).characters());
+    b.append("    (void)json;\n    (void)e;\n    bool valid = true;\n");
+    if (uses_matches)
+        b.append("    u32 matches = 0;\n");
+
+    for (u32 pc = entry; pc <= end; ++pc) {
+        if (labels.contains(pc))
+            b.appendf("L%u:\n", pc);
+        generate_instruction(b, code[pc], location);
+    }
+    b.append("}\n");
+}
+
+// Without errors to collect, the first failure decides.
+#define FAIL(...)                                \
+    do {                                         \
+        b.append("        if (!e)\n");           \
+        b.append("            return false;\n"); \
+        b.append("        e->add(");             \
+        b.appendf(__VA_ARGS__);                  \
+        b.append(");\n");                        \
+        b.append("        valid = false;\n");    \
+    } while (0)
+
+// After valid &= ..., at function scope.
+static const char* return_if_failed = "    if (!valid && !e)\n        return false;\n";
+
+void Generator::generate_instruction(StringBuilder& b, const Instruction& insn, const String& location)
+{
+    auto loc = string_literal(location);
+    auto* l = loc.characters();
+
+    switch (insn.opcode) {
+    case OpCode::CheckType:
+        b.appendf("    if (!%s) {\n", type_predicate(insn.a).characters());
+        FAIL("JsonValidator::ValidationErrorKind::Type, %s, json, 0, %u", l, insn.a);
+        b.appendf("        goto L%u;\n    }\n", insn.b);
+        break;
+
+    case OpCode::CheckPresent:
+        b.append("    if (json.is_undefined()) {\n");
+        FAIL("JsonValidator::ValidationErrorKind::NotPresent, %s, json", l);
+        b.appendf("        goto L%u;\n    }\n", insn.b);
+        break;
+
+    case OpCode::JumpIfNotType:
+        b.appendf("    if (!%s)\n        goto L%u;\n", type_predicate(insn.a).characters(), insn.b);
+        break;
+
+    case OpCode::Fail:
+        b.append("    {\n");
+        FAIL("JsonValidator::ValidationErrorKind::FalseSchema, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::Call:
+        b.appendf("    valid &= %s(json, e);\n", subroutine_name(insn.a).characters());
+        b.append(return_if_failed);
+        break;
+
+    case OpCode::BeginBranches:
+        b.append("    matches = 0;\n");
+        break;
+
+    case OpCode::CallBranch:
+        b.appendf("    if (%s(json, nullptr))\n        ++matches;\n", subroutine_name(insn.a).characters());
+        break;
+
+    case OpCode::JumpIfMatches:
+        b.appendf("    if (matches >= %u)\n        goto L%u;\n", insn.a, insn.b);
+        break;
+
+    case OpCode::TaggedBranches:
+        generate_tagged_branches(b, m_program.tagged_union_table(insn.a));
+        break;
+
+    case OpCode::EndAnyOf:
+        b.append("    if (!matches) {\n");
+        FAIL("JsonValidator::ValidationErrorKind::AnyOf, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::EndOneOf:
+        b.append("    if (matches != 1) {\n");
+        FAIL("JsonValidator::ValidationErrorKind::OneOf, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::EndNot:
+        b.append("    if (matches) {\n");
+        FAIL("JsonValidator::ValidationErrorKind::Not, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::Enum:
+        b.append("    if (!(");
+        generate_enum(b, m_program.enum_set(insn.a));
+        b.append(")) {\n");
+        FAIL("JsonValidator::ValidationErrorKind::Enum, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::Pattern: {
+        auto name = String::format("%s_pattern%zu", m_function_name.characters(), m_static_count++);
+        m_statics.appendf("static const JsonValidator::Pattern %s(%s);\n", name.characters(), string_literal(m_program.pattern(insn.a).source()).characters());
+        b.appendf("    if (!%s.matches(json.as_string())) {\n", name.characters());
+        FAIL("JsonValidator::ValidationErrorKind::Pattern, %s, json", l);
+        b.append("    }\n");
+        break;
+    }
+
+    case OpCode::MaxLength:
+        b.appendf("    if (JsonValidator::exceeds_max_length(json.as_string(), %u)) {\n", insn.a);
+        FAIL("JsonValidator::ValidationErrorKind::MaxLength, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::MinLength:
+        b.appendf("    if (JsonValidator::below_min_length(json.as_string(), %u)) {\n", insn.a);
+        FAIL("JsonValidator::ValidationErrorKind::MinLength, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::Format: {
+        auto format = (Format)insn.a;
+        b.appendf("    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::%s, json.as_string())) {\n", format_enumerator_name(format));
+        FAIL("JsonValidator::ValidationErrorKind::Format, %s, json, 0, %u", l, (u32)format);
+        b.append("    }\n");
+        break;
+    }
+
+    case OpCode::Minimum:
+    case OpCode::Maximum:
+    case OpCode::ExclusiveMinimum:
+    case OpCode::ExclusiveMaximum: {
+        auto kind = ValidationErrorKind::Minimum;
+        const char* violation = "<";
+        if (insn.opcode == OpCode::Maximum) {
+            kind = ValidationErrorKind::Maximum;
+            violation = ">";
+        } else if (insn.opcode == OpCode::ExclusiveMinimum) {
+            kind = ValidationErrorKind::ExclusiveMinimum;
+            violation = "<=";
+        } else if (insn.opcode == OpCode::ExclusiveMaximum) {
+            kind = ValidationErrorKind::ExclusiveMaximum;
+            violation = ">=";
+        }
+        auto bound = generate_number_constant(m_program.number(insn.a));
+        b.appendf("    if (%s.compare(json) %s 0) {\n", bound.characters(), violation);
+        FAIL("JsonValidator::ValidationErrorKind::%s, %s, json, json.to_number<double>(), %s.value()", to_string(kind), l, bound.characters());
+        b.append("    }\n");
+        break;
+    }
+
+    case OpCode::MultipleOf: {
+        auto divisor = generate_number_constant(m_program.number(insn.a));
+        b.appendf("    if (!%s.divides(json)) {\n", divisor.characters());
+        FAIL("JsonValidator::ValidationErrorKind::MultipleOf, %s, json, json.to_number<double>(), %s.value()", l, divisor.characters());
+        b.append("    }\n");
+        break;
+    }
+
+    case OpCode::MinProperties:
+        b.appendf("    if (json.as_object().size() < %u) {\n", insn.a);
+        FAIL("JsonValidator::ValidationErrorKind::MinProperties, %s, json, json.as_object().size(), %u", l, insn.a);
+        b.append("    }\n");
+        break;
+
+    case OpCode::MaxProperties:
+        b.appendf("    if (json.as_object().size() > %u) {\n", insn.a);
+        FAIL("JsonValidator::ValidationErrorKind::MaxProperties, %s, json, json.as_object().size(), %u", l, insn.a);
+        b.append("    }\n");
+        break;
+
+    case OpCode::DependentSchema:
+        b.appendf("    if (json.as_object().has(%s) && !%s(json, e)) {\n", string_literal(m_program.string(insn.a)).characters(), subroutine_name(insn.b).characters());
+        FAIL("JsonValidator::ValidationErrorKind::DependentSchema, %s, json", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::Properties:
+        generate_properties(b, m_program.property_table(insn.a), location);
+        break;
+
+    case OpCode::MinItems:
+        b.appendf("    if (json.as_array().values().size() < %u) {\n", insn.a);
+        FAIL("JsonValidator::ValidationErrorKind::MinItems, %s, json, json.as_array().values().size(), %u", l, insn.a);
+        b.appendf("        goto L%u;\n    }\n", insn.b);
+        break;
+
+    case OpCode::MaxItems:
+        b.appendf("    if (json.as_array().values().size() > %u) {\n", insn.a);
+        FAIL("JsonValidator::ValidationErrorKind::MaxItems, %s, json, json.as_array().values().size(), %u", l, insn.a);
+        b.appendf("        goto L%u;\n    }\n", insn.b);
+        break;
+
+    case OpCode::UniqueItems:
+        b.append("    if (auto* duplicate = JsonValidator::find_duplicate_item(json.as_array())) {\n");
+        FAIL("JsonValidator::ValidationErrorKind::UniqueItems, %s, json, JsonValidator::excerpt(*duplicate)", l);
+        b.append("    }\n");
+        break;
+
+    case OpCode::Items:
+        b.append("    {\n        auto& values = json.as_array().values();\n");
+        b.append("        for (size_t i = 0; i < values.size(); ++i) {\n");
+        b.append("            JsonValidator::InstanceLocationScope scope(e, i);\n");
+        b.appendf("            if (!%s(values[i], e)) {\n                if (!e)\n                    return false;\n                valid = false;\n            }\n        }\n    }\n", subroutine_name(insn.a).characters());
+        break;
+
+    case OpCode::TupleItems: {
+        auto& table = m_program.tuple_table(insn.a);
+        b.append("    {\n        auto& values = json.as_array().values();\n");
+        for (u32 i = 0; i < table.items.count; ++i)
+            b.appendf("        if (values.size() > %u) {\n            JsonValidator::InstanceLocationScope scope(e, (size_t)%u);\n            valid &= %s(values[%u], e);\n        }\n", i, i, subroutine_name(m_program.index(table.items.first + i)).characters(), i);
+        if (table.additional_items != invalid_index)
+            b.appendf("        for (size_t i = %u; i < values.size() && (valid || e); ++i) {\n            JsonValidator::InstanceLocationScope scope(e, i);\n            valid &= %s(values[i], e);\n        }\n", table.items.count, subroutine_name(table.additional_items).characters());
+        b.append("    }\n");
+        b.append(return_if_failed);
+        break;
+    }
+
+    case OpCode::Contains:
+        b.append("    {\n        bool contains_valid = false;\n");
+        b.append("        for (auto& value : json.as_array().values()) {\n");
+        b.appendf("            if (%s(value, nullptr)) {\n                contains_valid = true;\n                break;\n            }\n        }\n", subroutine_name(insn.a).characters());
+        b.append("        if (!contains_valid) {\n");
+        b.append("            if (!e)\n                return false;\n");
+        b.appendf("            e->add(JsonValidator::ValidationErrorKind::Contains, %s, json);\n", l);
+        b.append("            valid = false;\n        }\n    }\n");
+        break;
+
+    case OpCode::Return:
+        b.append("    return valid;\n");
+        break;
+    }
+}
+
+#undef FAIL
+
+String Generator::generate_number_constant(const NumberConstant& constant)
+{
+    auto name = String::format("%s_number%zu", m_function_name.characters(), m_static_count++);
+    String value;
+    if (constant.is_integer())
+        value = String::format("(i64)%s", integer_literal(constant.integer()).characters());
+    else if (constant.is_large_unsigned())
+        value = String::format("(u64)%lluULL", (unsigned long long)constant.large_unsigned());
+    else
+        value = number_literal(constant.value());
+    m_statics.appendf("static const JsonValidator::NumberConstant %s(%s);\n", name.characters(), value.characters());
+    return name;
+}
+
+void Generator::generate_tagged_branches(StringBuilder& b, const TaggedUnionTable& table)
+{
+    auto& tags = m_program.enum_set(table.tags);
+    JsonArray items;
+    for (auto& item : tags.items())
+        items.append(item);
+    auto name = String::format("%s_tags%zu", m_function_name.characters(), m_static_count++);
+    m_statics.appendf("static const JsonValidator::EnumSet %s(JsonValue::from_string(%s).as_array());\n", name.characters(), string_literal(items.to_string()).characters());
+
+    auto call_branches = [&](IndexRange branches, const char* indent) {
+        for (u32 i = 0; i < branches.count; ++i) {
+            b.appendf("%sif (matches < %u && %s(json, nullptr))\n", indent, table.stop_at_matches, subroutine_name(m_program.index(branches.first + i)).characters());
+            b.appendf("%s    ++matches;\n", indent);
+        }
+    };
+
+    b.append("    if (json.is_object()) {\n");
+    b.appendf("        auto* tag_value = json.as_object().get_ptr(%s);\n", string_literal(m_program.string(table.property)).characters());
+    b.appendf("        auto tag = tag_value ? %s.find(*tag_value) : Optional<u32> {};\n", name.characters());
+    b.append("        if (tag.has_value()) {\n");
+    b.append("            switch (tag.value()) {\n");
+    for (u32 tag = 0; tag < tags.size(); ++tag) {
+        u32 first = m_program.index(table.offsets.first + tag);
+        b.appendf("            case %u:\n", tag);
+        call_branches({ table.candidates.first + first, m_program.index(table.offsets.first + tag + 1) - first }, "                ");
+        b.append("                break;\n");
+    }
+    b.append("            }\n        }\n    } else {\n");
+    call_branches(table.branches, "        ");
+    b.append("    }\n");
+}
+
+void Generator::generate_enum(StringBuilder& b, const EnumSet& set)
+{
+    // a few items are compared inline, more go into a static EnumSet
+    if (set.size() > 8) {
+        JsonArray items;
+        for (auto& item : set.items())
+            items.append(item);
+        auto name = String::format("%s_enum%zu", m_function_name.characters(), m_static_count++);
+        m_statics.appendf("static const JsonValidator::EnumSet %s(JsonValue::from_string(%s).as_array());\n", name.characters(), string_literal(items.to_string()).characters());
+        b.appendf("%s.contains(json)", name.characters());
+        return;
+    }
+
+    for (size_t i = 0; i < set.size(); ++i) {
+        if (i != 0)
+            b.append("\n        || ");
+
+        auto& item = set.items()[i];
+        if (item.is_null()) {
+            b.append("json.is_null()");
+        } else if (item.is_bool()) {
+            b.appendf("(json.is_bool() && json.as_bool() == %s)", item.as_bool() ? "true" : "false");
+        } else if (item.is_string()) {
+            b.appendf("(json.is_string() && json.as_string() == %s)", string_literal(item.as_string()).characters());
+        } else if (item.is_number()) {
+            b.appendf("(json.is_number() && json.to_number<double>() == %s)", number_literal(item.to_number<double>()).characters());
+        } else {
+            auto name = String::format("%s_value%zu", m_function_name.characters(), m_static_count++);
+            m_statics.appendf("static const JsonValue %s = JsonValue::from_string(%s);\n", name.characters(), string_literal(item.to_string()).characters());
+            b.appendf("%s.equals(json)", name.characters());
+        }
+    }
+    if (set.is_empty())
+        b.append("false");
+}
+
+void Generator::generate_properties(StringBuilder& b, const PropertyTable& table, const String& location)
+{
+    auto loc = string_literal(location);
+    auto* l = loc.characters();
+
+    String pattern_set;
+    if (table.pattern_set != invalid_index) {
+        pattern_set = String::format("%s_patterns%zu", m_function_name.characters(), m_static_count++);
+        m_statics.appendf("static const JsonValidator::RegexSet %s = [] {\n    Vector<String> patterns;\n", pattern_set.characters());
+        for (u32 i = 0; i < table.pattern_properties.count; ++i) {
+            auto& pattern_property = m_program.pattern_property(table.pattern_properties.first + i);
+            m_statics.appendf("    patterns.append(%s);\n", string_literal(m_program.string(pattern_property.source)).characters());
+        }
+        m_statics.append("    return JsonValidator::RegexSet(patterns);\n}();\n");
+    }
+
+    bool track_presence = table.required.count || table.dependent_required.count;
+    // in a block of its own, the labels of later instructions mustn't jump over it
+    if (track_presence)
+        b.appendf("    {\n    u32 present[%u] = {};\n", presence_words(table));
+
+    b.append("    json.as_object().for_each_member([&](auto& key, auto& value) {\n");
+    b.append("        (void)value;\n");
+    b.append("        if (!valid && !e)\n            return;\n");
+    b.append("        JsonValidator::InstanceLocationScope scope(e, key);\n");
+    b.append("        bool declared = true;\n");
+
+    // dispatch on the key length first, then compare the few candidates with that length
+    struct Property {
+        const String* name;
+        u32 subroutine;
+        u32 slot;
+    };
+    Vector<Property> properties;
+    for (u32 i = 0; i < table.properties.count; ++i) {
+        auto& entry = m_program.property_entry(table.properties.first + i);
+        if (entry.name != invalid_index)
+            properties.append({ &m_program.string(entry.name), entry.subroutine, i });
+    }
+    quick_sort(properties.begin(), properties.end(), [](auto& a, auto& b) {
+        if (a.name->length() != b.name->length())
+            return a.name->length() < b.name->length();
+        return strcmp(a.name->characters(), b.name->characters()) < 0;
+    });
+
+    b.append("        switch (key.length()) {\n");
+    for (size_t i = 0; i < properties.size(); ++i) {
+        auto length = properties[i].name->length();
+        if (i == 0 || properties[i - 1].name->length() != length)
+            b.appendf("        case %zu:\n", length);
+        b.appendf("            if (key == %s) {\n", string_literal(*properties[i].name).characters());
+        if (track_presence)
+            b.appendf("                present[%u] |= 0x%xu;\n", properties[i].slot / 32, 1u << (properties[i].slot % 32));
+        if (properties[i].subroutine != invalid_index)
+            b.appendf("                valid &= %s(value, e);\n", subroutine_name(properties[i].subroutine).characters());
+        else
+            b.append("                declared = false;\n");
+        b.append("                break;\n            }\n");
+        if (i + 1 == properties.size() || properties[i + 1].name->length() != length)
+            b.append("            declared = false;\n            break;\n");
+    }
+    b.append("        default:\n            declared = false;\n        }\n");
+
+    b.append("        if (!declared) {\n");
+    b.append("            bool match = false;\n");
+    if (!pattern_set.is_null()) {
+        b.append("            JsonValidator::RegexMatches matches;\n");
+        b.appendf("            %s.search(key.characters(), key.length(), matches);\n", pattern_set.characters());
+        b.append("            for (auto pattern : matches) {\n");
+        b.append("                match = true;\n");
+        b.append("                switch (pattern) {\n");
+        for (u32 i = 0; i < table.pattern_properties.count; ++i) {
+            b.appendf("                case %u:\n", i);
+            b.appendf("                    valid &= %s(value, e);\n", subroutine_name(m_program.pattern_property(table.pattern_properties.first + i).subroutine).characters());
+            b.append("                    break;\n");
+        }
+        b.append("                }\n            }\n");
+    }
+    b.append("            if (!match) {\n");
+    if (table.additional_properties != invalid_index) {
+        b.appendf("                if (!%s(value, e)) {\n", subroutine_name(table.additional_properties).characters());
+        b.appendf("                    if (e)\n                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, %s, json);\n", l);
+        b.append("                    valid = false;\n                }\n");
+    } else {
+        b.appendf("                if (e)\n                    e->add(JsonValidator::ValidationErrorKind::UnexpectedProperty, %s, json, key);\n", l);
+        b.append("                valid = false;\n");
+    }
+    b.append("            }\n        }\n");
+
+    if (table.property_names != invalid_index) {
+        b.appendf("        if (!%s(JsonValue(key), e)) {\n", subroutine_name(table.property_names).characters());
+        b.appendf("            if (e)\n                e->add(JsonValidator::ValidationErrorKind::PropertyNames, %s, json);\n", l);
+        b.append("            valid = false;\n        }\n");
+    }
+    b.append("    });\n");
+    b.append(return_if_failed);
+
+    // a word of the presence mask at a time, the names only matter for the errors
+    auto generate_presence_check = [&](const IndexRange& mask, const char* kind) {
+        for (u32 i = 0; i < mask.count; ++i) {
+            u32 word = m_program.index(mask.first + i);
+            if (!word)
+                continue;
+            b.appendf("    if ((present[%u] & 0x%xu) != 0x%xu) {\n", i, word, word);
+            for (u32 bit = 0; bit < 32; ++bit) {
+                if (!(word & (1u << bit)))
+                    continue;
+                auto name = string_literal(m_program.string(m_program.property_entry(table.properties.first + i * 32 + bit).name));
+                b.appendf("    if (!(present[%u] & 0x%xu)) {\n", i, 1u << bit);
+                b.appendf("        if (!e)\n            return false;\n        e->add(JsonValidator::ValidationErrorKind::%s, %s, json, %s);\n", kind, l, name.characters());
+                b.append("        valid = false;\n    }\n");
+            }
+            b.append("    }\n");
+        }
+    };
+
+    generate_presence_check(table.required, "Required");
+    for (u32 i = 0; i < table.dependent_required.count; ++i) {
+        auto& dependent_table = m_program.dependent_required_table(table.dependent_required.first + i);
+        b.appendf("    if (present[%u] & 0x%xu) {\n", dependent_table.property / 32, 1u << (dependent_table.property % 32));
+        generate_presence_check(dependent_table.dependencies, "DependentRequired");
+        b.append("    }\n");
+    }
+    if (track_presence)
+        b.append("    }\n");
+}
+
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <LibJsonValidator/Bytecode.h>
+#include <LibJsonValidator/Forward.h>
+
+namespace JsonValidator {
+
+// Emits C++ source for a compiled Program. Each subroutine becomes a static
+// function with all constants inlined, jumps become gotos. The generated code
+// only depends on AK and the keyword helpers of LibJsonValidator.
+class Generator {
+public:
+    Generator(const Program& program, const String& function_name)
+        : m_program(program)
+        , m_function_name(function_name)
+    {
+    }
+
+    static void generate_preamble(StringBuilder&);
+
+    // Emits `bool function_name(const JsonValue&, JsonValidator::ValidationError&)`, and
+    // `bool function_name(const JsonValue&)` that only returns the verdict.
+    void generate(StringBuilder&);
+
+private:
+    String subroutine_name(u32 subroutine) const;
+    void generate_subroutine(StringBuilder&, u32 subroutine);
+    void generate_instruction(StringBuilder&, const Instruction&, const String& location);
+    void generate_enum(StringBuilder&, const EnumSet&);
+    void generate_tagged_branches(StringBuilder&, const TaggedUnionTable&);
+    // Returns the name of a static holding the constant.
+    String generate_number_constant(const NumberConstant&);
+    void generate_properties(StringBuilder&, const PropertyTable&, const String& location);
+
+    const Program& m_program;
+    String m_function_name;
+    StringBuilder m_statics;
+    size_t m_static_count { 0 };
+};
+
+}
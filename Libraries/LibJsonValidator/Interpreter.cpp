@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/QuickSort.h>
+#include <LibJsonValidator/Interpreter.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+#include <LibJsonValidator/Keywords.h>
+#include <LibJsonValidator/Profile.h>
+#include <LibJsonValidator/Validator.h>
+
+namespace JsonValidator {
+
+// The symbols of the keys of an object instance, looked up once per subroutine run
+// and shared by all keywords that ask for properties of the instance.
+class InstanceSymbols {
+public:
+    explicit InstanceSymbols(const Program& program)
+        : m_program(program)
+    {
+    }
+
+    void ensure(const JsonObject& object)
+    {
+        if (m_computed)
+            return;
+        m_computed = true;
+
+        object.for_each_member([&](auto& key, auto&) {
+            u32 symbol = m_program.symbol(key);
+            if (symbol != invalid_index)
+                m_sorted.append(symbol);
+        });
+        quick_sort(m_sorted.begin(), m_sorted.end(), [](u32 a, u32 b) { return a < b; });
+    }
+
+    bool contains(u32 symbol) const
+    {
+        size_t low = 0;
+        size_t high = m_sorted.size();
+        while (low < high) {
+            size_t middle = low + (high - low) / 2;
+            if (m_sorted[middle] == symbol)
+                return true;
+            if (symbol < m_sorted[middle])
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        return false;
+    }
+
+private:
+    const Program& m_program;
+    bool m_computed { false };
+    Vector<u32, 32> m_sorted;
+};
+
+bool Interpreter::execute_branch(u32 subroutine, const JsonValue& json) const
+{
+    if (!m_profile)
+        return execute(subroutine, json, nullptr);
+
+    u64 executed_before = m_executed_instructions;
+    bool matched = execute(subroutine, json, nullptr);
+    m_profile->record_branch(m_program.location(subroutine), matched, m_executed_instructions - executed_before);
+    return matched;
+}
+
+KeyClassification Interpreter::classify_key(const PropertyTable& table, const String& key) const
+{
+    KeyClassification classification;
+    classification.slot = m_program.find_property_slot(table, key);
+    bool declared = classification.slot != invalid_index && m_program.property_entry(table.properties.first + classification.slot).subroutine != invalid_index;
+
+    if (!declared) {
+        // match all pattern properties in one pass over the key
+        if (table.pattern_set != invalid_index)
+            m_program.pattern_set(table.pattern_set).search(key.characters(), key.length(), classification.patterns);
+        classification.additional = classification.patterns.is_empty();
+    }
+
+    if (table.property_names != invalid_index)
+        classification.property_name_valid = execute(table.property_names, JsonValue(key), nullptr);
+    return classification;
+}
+
+KeyClassification Interpreter::classification_of_key(u32 table_index, const String& key) const
+{
+    auto& table = m_program.property_table(table_index);
+    if (table.pattern_set == invalid_index && table.property_names == invalid_index)
+        return classify_key(table, key);
+
+    KeyClassification classification;
+    if (!m_program.find_key_classification(table_index, key, classification)) {
+        classification = classify_key(table, key);
+        m_program.cache_key_classification(table_index, key, classification);
+    }
+    return classification;
+}
+
+bool Interpreter::run(const JsonValue& json, ValidationError& e) const
+{
+    if (m_program.is_empty())
+        return false;
+    return execute(0, json, &e);
+}
+
+bool Interpreter::run(const JsonValue& json) const
+{
+    if (m_program.is_empty())
+        return false;
+    return execute(0, json, nullptr);
+}
+
+bool Interpreter::execute(u32 subroutine, const JsonValue& json, ValidationError* e) const
+{
+    auto* code = m_program.code().data();
+    auto& location = m_program.location(subroutine);
+    u32 pc = m_program.subroutine(subroutine).entry;
+    bool valid = true;
+    u32 matches = 0;
+    InstanceSymbols symbols(m_program);
+
+    for (;;) {
+        auto& insn = code[pc++];
+        if (m_profile)
+            ++m_executed_instructions;
+
+#ifdef JSON_SCHEMA_DEBUG
+        printf("sub%u @%u: %s\n", subroutine, pc - 1, to_string(insn.opcode));
+#endif
+
+        switch (insn.opcode) {
+        case OpCode::CheckType:
+            if (!has_type(insn.a, json)) {
+                if (e)
+                    e->add(ValidationErrorKind::Type, location, json, 0, insn.a);
+                valid = false;
+                pc = insn.b;
+            }
+            break;
+
+        case OpCode::CheckPresent:
+            if (json.is_undefined()) {
+                if (e)
+                    e->add(ValidationErrorKind::NotPresent, location, json);
+                valid = false;
+                pc = insn.b;
+            }
+            break;
+
+        case OpCode::JumpIfNotType:
+            if (!has_type(insn.a, json))
+                pc = insn.b;
+            break;
+
+        case OpCode::Fail:
+            if (e)
+                e->add(ValidationErrorKind::FalseSchema, location, json);
+            valid = false;
+            break;
+
+        case OpCode::Call:
+            valid &= execute(insn.a, json, e);
+            break;
+
+        case OpCode::BeginBranches:
+            matches = 0;
+            break;
+
+        case OpCode::CallBranch:
+            if (execute_branch(insn.a, json))
+                ++matches;
+            break;
+
+        case OpCode::TaggedBranches: {
+            auto& table = m_program.tagged_union_table(insn.a);
+            IndexRange branches = table.branches;
+            if (json.is_object()) {
+                auto* tag_value = json.as_object().get_ptr(m_program.string(table.property));
+                auto tag = tag_value ? m_program.enum_set(table.tags).find(*tag_value) : Optional<u32> {};
+                if (!tag.has_value())
+                    break;
+                u32 first = m_program.index(table.offsets.first + tag.value());
+                branches = { table.candidates.first + first, m_program.index(table.offsets.first + tag.value() + 1) - first };
+            }
+            for (u32 i = 0; i < branches.count && matches < table.stop_at_matches; ++i) {
+                if (execute_branch(m_program.index(branches.first + i), json))
+                    ++matches;
+            }
+            break;
+        }
+
+        case OpCode::JumpIfMatches:
+            if (matches >= insn.a)
+                pc = insn.b;
+            break;
+
+        case OpCode::EndAnyOf:
+            if (!matches) {
+                if (e)
+                    e->add(ValidationErrorKind::AnyOf, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::EndOneOf:
+            if (matches != 1) {
+                if (e)
+                    e->add(ValidationErrorKind::OneOf, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::EndNot:
+            if (matches) {
+                if (e)
+                    e->add(ValidationErrorKind::Not, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::Enum:
+            if (!m_program.enum_set(insn.a).contains(json)) {
+                if (e)
+                    e->add(ValidationErrorKind::Enum, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::Pattern:
+            if (!m_program.pattern(insn.a).matches(json.as_string())) {
+                if (e)
+                    e->add(ValidationErrorKind::Pattern, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::MaxLength:
+            if (exceeds_max_length(json.as_string(), insn.a)) {
+                if (e)
+                    e->add(ValidationErrorKind::MaxLength, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::MinLength:
+            if (below_min_length(json.as_string(), insn.a)) {
+                if (e)
+                    e->add(ValidationErrorKind::MinLength, location, json);
+                valid = false;
+            }
+            break;
+
+        case OpCode::Format:
+            if (json.is_string() && !matches_format((Format)insn.a, json.as_string())) {
+                if (e)
+                    e->add(ValidationErrorKind::Format, location, json, 0, insn.a);
+                valid = false;
+            }
+            break;
+
+        case OpCode::Minimum:
+            if (m_program.number(insn.a).compare(json) < 0) {
+                if (e)
+                    e->add(ValidationErrorKind::Minimum, location, json, json.to_number<double>(), m_program.number(insn.a).value());
+                valid = false;
+            }
+            break;
+
+        case OpCode::Maximum:
+            if (m_program.number(insn.a).compare(json) > 0) {
+                if (e)
+                    e->add(ValidationErrorKind::Maximum, location, json, json.to_number<double>(), m_program.number(insn.a).value());
+                valid = false;
+            }
+            break;
+
+        case OpCode::ExclusiveMinimum:
+            if (m_program.number(insn.a).compare(json) <= 0) {
+                if (e)
+                    e->add(ValidationErrorKind::ExclusiveMinimum, location, json, json.to_number<double>(), m_program.number(insn.a).value());
+                valid = false;
+            }
+            break;
+
+        case OpCode::ExclusiveMaximum:
+            if (m_program.number(insn.a).compare(json) >= 0) {
+                if (e)
+                    e->add(ValidationErrorKind::ExclusiveMaximum, location, json, json.to_number<double>(), m_program.number(insn.a).value());
+                valid = false;
+            }
+            break;
+
+        case OpCode::MultipleOf:
+            if (!m_program.number(insn.a).divides(json)) {
+                if (e)
+                    e->add(ValidationErrorKind::MultipleOf, location, json, json.to_number<double>(), m_program.number(insn.a).value());
+                valid = false;
+            }
+            break;
+
+        case OpCode::MinProperties:
+            if (json.as_object().size() < (int)insn.a) {
+                if (e)
+                    e->add(ValidationErrorKind::MinProperties, location, json, json.as_object().size(), insn.a);
+                valid = false;
+            }
+            break;
+
+        case OpCode::MaxProperties:
+            if (json.as_object().size() > (int)insn.a) {
+                if (e)
+                    e->add(ValidationErrorKind::MaxProperties, location, json, json.as_object().size(), insn.a);
+                valid = false;
+            }
+            break;
+
+        case OpCode::DependentSchema:
+            symbols.ensure(json.as_object());
+            if (symbols.contains(insn.a)) {
+                if (!execute(insn.b, json, e)) {
+                    if (e)
+                        e->add(ValidationErrorKind::DependentSchema, location, json);
+                    valid = false;
+                }
+            }
+            break;
+
+        case OpCode::Properties: {
+            auto& table = m_program.property_table(insn.a);
+            bool track_presence = table.required.count || table.dependent_required.count;
+            Vector<u32, 8> present;
+            if (track_presence) {
+                for (u32 i = 0; i < presence_words(table); ++i)
+                    present.append(0);
+            }
+
+            json.as_object().for_each_member([&](auto& key, auto& value) {
+                if (!valid && !e)
+                    return;
+                InstanceLocationScope scope(e, key);
+
+                // a copy, nested objects may add to the cache
+                auto classification = classification_of_key(insn.a, key);
+
+                u32 property = invalid_index;
+                if (classification.slot != invalid_index) {
+                    if (track_presence)
+                        present[classification.slot / 32] |= 1u << (classification.slot % 32);
+                    property = m_program.property_entry(table.properties.first + classification.slot).subroutine;
+                }
+
+                if (property != invalid_index) {
+                    valid &= execute(property, value, e);
+
+                } else {
+                    for (auto pattern : classification.patterns)
+                        valid &= execute(m_program.pattern_property(table.pattern_properties.first + pattern).subroutine, value, e);
+
+                    // it's time to check against additionalProperties, if available
+                    if (classification.additional) {
+                        if (table.additional_properties != invalid_index) {
+                            if (!execute(table.additional_properties, value, e)) {
+                                if (e)
+                                    e->add(ValidationErrorKind::AdditionalProperty, location, json);
+                                valid = false;
+                            }
+                        } else {
+                            if (e)
+                                e->add(ValidationErrorKind::UnexpectedProperty, location, json, key);
+                            valid = false;
+                        }
+                    }
+                }
+
+                if (!classification.property_name_valid) {
+                    if (e) {
+                        // run again for the errors
+                        execute(table.property_names, JsonValue(key), e);
+                        e->add(ValidationErrorKind::PropertyNames, location, json);
+                    }
+                    valid = false;
+                }
+            });
+
+            if (track_presence) {
+                // Calls the callback with the name of every property of the mask that isn't present.
+                auto check_presence = [&](const IndexRange& mask, auto callback) {
+                    for (u32 i = 0; i < mask.count; ++i) {
+                        u32 missing = m_program.index(mask.first + i) & ~present[i];
+                        if (!missing)
+                            continue;
+                        valid = false;
+                        if (!e)
+                            return;
+                        for (; missing; missing &= missing - 1) {
+                            u32 slot = i * 32 + __builtin_ctz(missing);
+                            callback(m_program.string(m_program.property_entry(table.properties.first + slot).name));
+                        }
+                    }
+                };
+
+                check_presence(table.required, [&](auto& name) {
+                    e->add(ValidationErrorKind::Required, location, json, name);
+                });
+                for (u32 i = 0; i < table.dependent_required.count; ++i) {
+                    auto& dependent_table = m_program.dependent_required_table(table.dependent_required.first + i);
+                    if (!(present[dependent_table.property / 32] & (1u << (dependent_table.property % 32))))
+                        continue;
+                    check_presence(dependent_table.dependencies, [&](auto& name) {
+                        e->add(ValidationErrorKind::DependentRequired, location, json, name);
+                    });
+                }
+            }
+            break;
+        }
+
+        case OpCode::MinItems:
+            if (json.as_array().values().size() < insn.a) {
+                if (e)
+                    e->add(ValidationErrorKind::MinItems, location, json, json.as_array().values().size(), insn.a);
+                valid = false;
+                pc = insn.b;
+            }
+            break;
+
+        case OpCode::MaxItems:
+            if (json.as_array().values().size() > insn.a) {
+                if (e)
+                    e->add(ValidationErrorKind::MaxItems, location, json, json.as_array().values().size(), insn.a);
+                valid = false;
+                pc = insn.b;
+            }
+            break;
+
+        case OpCode::UniqueItems:
+            if (auto* duplicate = find_duplicate_item(json.as_array())) {
+                if (e)
+                    e->add(ValidationErrorKind::UniqueItems, location, json, excerpt(*duplicate));
+                valid = false;
+            }
+            break;
+
+        case OpCode::Items: {
+            auto& values = json.as_array().values();
+            for (size_t i = 0; i < values.size(); ++i) {
+                InstanceLocationScope scope(e, i);
+                valid &= execute(insn.a, values[i], e);
+                if (!valid && !e)
+                    break;
+            }
+            break;
+        }
+
+        case OpCode::TupleItems: {
+            auto& table = m_program.tuple_table(insn.a);
+            auto& values = json.as_array().values();
+            for (size_t i = 0; i < values.size(); ++i) {
+                InstanceLocationScope scope(e, i);
+                if (i < table.items.count)
+                    valid &= execute(m_program.index(table.items.first + i), values[i], e);
+                else if (table.additional_items != invalid_index)
+                    valid &= execute(table.additional_items, values[i], e);
+                else
+                    break;
+                if (!valid && !e)
+                    break;
+            }
+            break;
+        }
+
+        case OpCode::Contains: {
+            bool contains_valid = false;
+            for (auto& value : json.as_array().values()) {
+                if (execute(insn.a, value, nullptr)) {
+                    contains_valid = true;
+                    break;
+                }
+            }
+            if (!contains_valid) {
+                if (e)
+                    e->add(ValidationErrorKind::Contains, location, json);
+                valid = false;
+            }
+            break;
+        }
+
+        case OpCode::Return:
+            return valid;
+        }
+
+        // without errors to collect, the first failure decides
+        if (!valid && !e)
+            return false;
+    }
+}
+
+}
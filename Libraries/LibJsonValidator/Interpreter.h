@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/JsonValue.h>
+#include <LibJsonValidator/Bytecode.h>
+#include <LibJsonValidator/Forward.h>
+
+namespace JsonValidator {
+
+class ValidationError;
+
+class Interpreter {
+public:
+    explicit Interpreter(const Program& program)
+        : m_program(program)
+    {
+    }
+
+    bool run(const JsonValue&, ValidationError&) const;
+    // Only decides whether the instance is valid, stopping at the first failure.
+    bool run(const JsonValue&) const;
+
+    // Records the matches and costs of anyOf/oneOf branches into the profile.
+    void set_profile(Profile* profile) { m_profile = profile; }
+
+private:
+    friend class StreamingValidator;
+
+    // Errors are only collected if `e` is not null, branches of anyOf/oneOf/not are run without collecting errors.
+    // Without `e` only the result matters, so execution stops as soon as it is false.
+    bool execute(u32 subroutine, const JsonValue&, ValidationError* e) const;
+    // Runs an anyOf/oneOf/not branch, recording it into the profile if there is one.
+    bool execute_branch(u32 subroutine, const JsonValue&) const;
+    KeyClassification classify_key(const PropertyTable&, const String& key) const;
+    // Classifies through the cache for tables with pattern properties or propertyNames,
+    // the others only need the slot of the key.
+    KeyClassification classification_of_key(u32 table, const String& key) const;
+
+    const Program& m_program;
+    Profile* m_profile { nullptr };
+    // the cost measure of the profile, only counted while one is recorded
+    mutable u64 m_executed_instructions { 0 };
+};
+
+}
@@ -28,6 +28,7 @@
 
 #include "Forward.h"
 #include <AK/Badge.h>
+#include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <AK/JsonValue.h>
@@ -35,16 +36,13 @@
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
+#include <LibJsonValidator/EnumSet.h>
+#include <LibJsonValidator/Format.h>
+#include <LibJsonValidator/NumberConstant.h>
 #include <cstdio>
 
-#ifndef __serenity__
-#    include <regex.h>
-#endif
-
 namespace JsonValidator {
 
-class ValidationError;
-
 enum class InstanceType : u8 {
     Undefined,
     Null,
@@ -57,17 +55,37 @@ enum class InstanceType : u8 {
 
 String to_string(InstanceType type);
 
+// The instance types accepted by a node as a bitmask. Integers have a bit of their own,
+// "number" accepts TypeMaskInteger | TypeMaskNumber and "integer" only TypeMaskInteger.
+typedef u8 TypeMask;
+
+enum : TypeMask {
+    TypeMaskNull = 1 << 0,
+    TypeMaskBoolean = 1 << 1,
+    TypeMaskObject = 1 << 2,
+    TypeMaskArray = 1 << 3,
+    TypeMaskString = 1 << 4,
+    TypeMaskInteger = 1 << 5,
+    TypeMaskNumber = 1 << 6,
+    TypeMaskAny = 0x7f,
+};
+
+// Returns 0 for unknown type names.
+TypeMask type_mask_from_string(const String& type_str);
+TypeMask type_mask_from_instance_type(InstanceType);
+String type_mask_to_string(TypeMask);
+
 class JsonSchemaNode {
 public:
     virtual ~JsonSchemaNode() = default;
     virtual const char* class_name() const = 0;
     virtual void dump(int indent) const;
-    virtual bool validate(const JsonValue&, ValidationError& e) const;
 
-    void set_default_value(JsonValue default_value) { m_default_value = default_value; }
+    void set_default_value(const JsonValue& default_value) { m_default_value = default_value; }
     void set_id(String id) { m_id = id; }
     void set_type(InstanceType type) { m_type = type; }
     void set_type_str(const String& type_str) { m_type_str = type_str; }
+    void set_accepted_types(TypeMask accepted_types) { m_accepted_types = accepted_types; }
     void set_required(bool required) { m_required = required; }
 
     void append_all_of(NonnullOwnPtr<JsonSchemaNode>&& node) { m_all_of.append(move(node)); }
@@ -82,94 +100,33 @@ public:
     const HashMap<String, NonnullOwnPtr<JsonSchemaNode>>& defs() const { return m_defs; }
     const OwnPtr<JsonSchemaNode>& get_not() const { return m_not; }
 
-    void set_anchors(HashMap<String, JsonSchemaNode*>&& anchors) { m_anchors = move(anchors); }
+    bool append_enum_item(const JsonValue& enum_item) { return m_enum_items.add(enum_item); }
+    // Only checked for string instances.
+    void set_format(Format format) { m_format = format; }
 
-    bool append_enum_item(JsonValue enum_item)
-    {
-        for (auto& item : m_enum_items) {
-            if (enum_item.equals(item))
-                return false;
-        }
-
-        m_enum_items.append(enum_item);
-        return true;
-    }
-
-    void compile_pattern(const String pattern)
+    void set_property_pattern(const String& pattern)
     {
         m_identified_by_pattern = true;
         m_pattern = pattern;
-#ifndef __serenity__
-        if (regcomp(&m_pattern_regex, pattern.characters(), REG_EXTENDED)) {
-            perror("regcomp");
-        }
-#endif
-    }
-
-    bool match_against_pattern(const String& value) const
-    {
-#ifdef __serenity__
-        UNUSED_PARAM(value);
-        if (m_pattern == "^.*$") {
-            // FIXME: Match everything, to be replaced with below code from else case when
-            // posix pattern matching implemented
-            return true;
-        }
-#else
-        int reti = regexec(&m_pattern_regex, value.characters(), 0, NULL, 0);
-        if (!reti) {
-            return true;
-        } else if (reti == REG_NOMATCH) {
-        } else {
-            char buf[100];
-            regerror(reti, &m_pattern_regex, buf, sizeof(buf));
-            fprintf(stderr, "Regex match failed: %s\n", buf);
-        }
-#endif
-        return false;
     }
 
     bool required() const { return m_required; }
     InstanceType type() const { return m_type; }
     const String& type_str() const { return m_type_str; }
+    TypeMask accepted_types() const { return m_accepted_types; }
     const String& id() const { return m_id; }
-    JsonValue default_value() const { return m_default_value; }
-    const Vector<JsonValue>& enum_items() const { return m_enum_items; }
+    const JsonValue& default_value() const { return m_default_value; }
+    const EnumSet& enum_items() const { return m_enum_items; }
+    const Optional<Format>& format() const { return m_format; }
     const String& pattern() const { return m_pattern; }
-    const HashMap<String, JsonSchemaNode*>& anchors() const { return m_anchors; }
 
     const JsonSchemaNode* parent() const { return m_parent; }
     const JsonSchemaNode* reference() const { return m_reference; }
+    void set_reference(const JsonSchemaNode* reference) { m_reference = reference; }
 
-    void set_ref(const String& ref)
-    {
-        m_ref = ref;
-        if (m_ref.contains("%")) {
-            for (u8 i = 0; i < 255; ++i) {
-                StringBuilder hex_lowercase, hex_uppercase, replacement;
-                hex_lowercase.append("%");
-                hex_uppercase.append("%");
-                if (i < 16) {
-                    hex_lowercase.appendf("0%x", i, i);
-                    hex_uppercase.appendf("0%X", i, i);
-                } else {
-                    hex_lowercase.appendf("%x", i, i);
-                    hex_uppercase.appendf("%X", i, i);
-                }
-
-                if (i == 47) // 0x2F = '/'
-                    replacement.append("~1");
-                else if (i == 126) // 0x7E = '~'
-                    replacement.append("~0");
-                else
-                    replacement.append(char(i));
-
-                auto repl = replacement.build();
-                m_ref.replace(hex_lowercase.build(), repl, true);
-                m_ref.replace(hex_uppercase.build(), repl, true);
-            }
-        }
-    }
+    // The $ref value, percent-decoded. Segments of a JSON pointer keep their ~0/~1 escapes.
+    const String& ref() const { return m_ref; }
+    void set_ref(const String& ref) { m_ref = ref; }
 
     void set_root(Badge<Parser>) { m_root = true; }
 
@@ -182,18 +139,13 @@ public:
     virtual bool is_string() const { return false; }
     bool is_root() const { return m_root; }
 
-    virtual void resolve_reference(const JsonSchemaNode* root_node);
-    virtual const JsonSchemaNode* resolve_reference_handle_identifer(const String& identifier, const JsonSchemaNode* root_node) const;
-
-    const JsonSchemaNode* resolve_reference(const String& ref, const JsonSchemaNode* node) const;
+    // Calls the callback for every direct subschema, with the JSON pointer segments
+    // leading from this node to it, e.g. "properties/foo" or "allOf/0".
+    virtual void for_each_subschema(Function<void(const String&, JsonSchemaNode&)>);
 
-    const String& json_pointer() const
-    {
-        static String s_json_pointer;
-        if (s_json_pointer.is_empty())
-            s_json_pointer = calculate_json_pointer();
-        return s_json_pointer;
-    }
+    // Set by the Parser once the tree is complete.
+    const String& json_pointer() const { return m_json_pointer; }
+    void set_json_pointer(Badge<Parser>, const String& json_pointer) { m_json_pointer = json_pointer; }
 
 protected:
     JsonSchemaNode() = default;
@@ -212,23 +164,21 @@ protected:
     }
 
 private:
-    String calculate_json_pointer() const;
-
     String m_id;
     InstanceType m_type;
     String m_type_str;
+    TypeMask m_accepted_types { TypeMaskAny };
     JsonValue m_default_value;
-    Vector<JsonValue> m_enum_items;
+    EnumSet m_enum_items;
+    Optional<Format> m_format;
     bool m_identified_by_pattern { false };
     bool m_root { false };
     String m_pattern;
-#ifndef __serenity__
-    regex_t m_pattern_regex;
-#endif
 
     const JsonSchemaNode* m_parent { nullptr };
     const JsonSchemaNode* m_reference { nullptr };
     String m_ref;
+    String m_json_pointer;
     bool m_required { false };
 
     NonnullOwnPtrVector<JsonSchemaNode> m_all_of;
@@ -236,9 +186,10 @@ private:
     NonnullOwnPtrVector<JsonSchemaNode> m_one_of;
     OwnPtr<JsonSchemaNode> m_not;
     HashMap<String, NonnullOwnPtr<JsonSchemaNode>> m_defs;
-    HashMap<String, JsonSchemaNode*> m_anchors;
 };
 
+String escape_json_pointer_segment(const String&);
+
 class StringNode : public JsonSchemaNode {
 public:
     StringNode(String id)
@@ -251,23 +202,15 @@ public:
     {
     }
 
-    virtual bool validate(const JsonValue&, ValidationError&) const override;
     virtual bool is_string() const override { return true; }
 
-    void set_pattern(const String& pattern)
-    {
-        printf("Set pattern: %s\n", pattern.characters());
-        m_pattern = pattern;
-#ifndef __serenity__
-        if (regcomp(&m_pattern_regex, pattern.characters(), REG_EXTENDED)) {
-            perror("regcomp");
-        }
-#endif
-    }
+    void set_pattern(const String& pattern) { m_pattern = pattern; }
     void set_max_length(i32 max_length) { m_max_length = max_length; }
     void set_min_length(i32 min_length) { m_min_length = min_length; }
 
-    bool match_against_pattern(const String& value) const;
+    const Optional<String>& pattern() const { return m_pattern; }
+    const Optional<u32>& max_length() const { return m_max_length; }
+    const Optional<u32>& min_length() const { return m_min_length; }
 
 private:
     virtual const char* class_name() const override { return "StringNode"; }
@@ -275,10 +218,6 @@ private:
     Optional<u32> m_max_length;
     Optional<u32> m_min_length;
     Optional<String> m_pattern;
-
-#ifndef __serenity__
-    regex_t m_pattern_regex;
-#endif
 };
 
 class NumberNode : public JsonSchemaNode {
@@ -293,23 +232,28 @@ public:
     {
     }
 
-    virtual bool validate(const JsonValue&, ValidationError&) const override;
     virtual bool is_number() const override { return true; }
 
-    void set_minimum(double value) { m_minimum = value; }
-    void set_maximum(double value) { m_maximum = value; }
-    void set_exclusive_minimum(double value) { m_exclusive_minimum = value; }
-    void set_exclusive_maximum(double value) { m_exclusive_maximum = value; }
-    void set_multiple_of(double value) { m_multiple_of = value; }
+    void set_minimum(const NumberConstant& value) { m_minimum = value; }
+    void set_maximum(const NumberConstant& value) { m_maximum = value; }
+    void set_exclusive_minimum(const NumberConstant& value) { m_exclusive_minimum = value; }
+    void set_exclusive_maximum(const NumberConstant& value) { m_exclusive_maximum = value; }
+    void set_multiple_of(const NumberConstant& value) { m_multiple_of = value; }
+
+    const Optional<NumberConstant>& minimum() const { return m_minimum; }
+    const Optional<NumberConstant>& maximum() const { return m_maximum; }
+    const Optional<NumberConstant>& exclusive_minimum() const { return m_exclusive_minimum; }
+    const Optional<NumberConstant>& exclusive_maximum() const { return m_exclusive_maximum; }
+    const Optional<NumberConstant>& multiple_of() const { return m_multiple_of; }
 
 private:
     virtual const char* class_name() const override { return "NumberNode"; }
 
-    Optional<double> m_multiple_of;
-    Optional<double> m_maximum;
-    Optional<double> m_exclusive_maximum;
-    Optional<double> m_minimum;
-    Optional<double> m_exclusive_minimum;
+    Optional<NumberConstant> m_multiple_of;
+    Optional<NumberConstant> m_maximum;
+    Optional<NumberConstant> m_exclusive_maximum;
+    Optional<NumberConstant> m_minimum;
+    Optional<NumberConstant> m_exclusive_minimum;
 };
 
 class BooleanNode : public JsonSchemaNode {
@@ -331,9 +275,10 @@ public:
     {
     }
 
-    virtual bool validate(const JsonValue&, ValidationError&) const override;
     virtual bool is_boolean() const override { return true; }
 
+    const Optional<bool>& value() const { return m_value; }
+
 private:
     virtual const char* class_name() const override { return "BooleanNode"; }
 
@@ -389,10 +334,8 @@ public:
     }
 
     virtual void dump(int indent) const override;
-    virtual bool validate(const JsonValue&, ValidationError&) const override;
     virtual bool is_object() const override { return true; }
-    virtual void resolve_reference(const JsonSchemaNode* root_node) override;
-    virtual const JsonSchemaNode* resolve_reference_handle_identifer(const String& identifier, const JsonSchemaNode* root_node) const override;
+    virtual void for_each_subschema(Function<void(const String&, JsonSchemaNode&)>) override;
 
     void append_property(const String name, NonnullOwnPtr<JsonSchemaNode>&& node)
     {
@@ -441,8 +384,14 @@ public:
 
     HashMap<String, NonnullOwnPtr<JsonSchemaNode>>& properties() { return m_properties; }
     const HashMap<String, NonnullOwnPtr<JsonSchemaNode>>& properties() const { return m_properties; }
+    const NonnullOwnPtrVector<JsonSchemaNode>& pattern_properties() const { return m_pattern_properties; }
     const HashTable<String>& required() const { return m_required; }
     const HashMap<String, HashTable<String>>& dependent_required() const { return m_dependent_required; }
+    const HashMap<String, NonnullOwnPtr<JsonSchemaNode>>& dependent_schemas() const { return m_dependent_schemas; }
+    const OwnPtr<JsonSchemaNode>& additional_properties() const { return m_additional_properties; }
+    const OwnPtr<JsonSchemaNode>& property_names() const { return m_property_names; }
+    const Optional<u32>& max_properties() const { return m_max_properties; }
+    u32 min_properties() const { return m_min_properties; }
 
 private:
     virtual const char* class_name() const override { return "ObjectNode"; }
@@ -472,10 +421,8 @@ public:
     }
 
     virtual void dump(int indent) const override;
-    virtual bool validate(const JsonValue&, ValidationError&) const override;
     virtual bool is_array() const override { return true; }
-    virtual void resolve_reference(const JsonSchemaNode* root_node) override;
-    virtual const JsonSchemaNode* resolve_reference_handle_identifer(const String& identifier, const JsonSchemaNode* root_node) const override;
+    virtual void for_each_subschema(Function<void(const String&, JsonSchemaNode&)>) override;
 
     const NonnullOwnPtrVector<JsonSchemaNode>& items() const { return m_items; }
     void append_item(NonnullOwnPtr<JsonSchemaNode>&& item) { m_items.append(move(item)); }
@@ -495,6 +442,9 @@ public:
     void set_max_items(u32 value) { m_max_items = value; }
     void set_min_items(u32 value) { m_min_items = value; }
 
+    const Optional<u32>& max_items() const { return m_max_items; }
+    u32 min_items() const { return m_min_items; }
+
 private:
     virtual const char* class_name() const override { return "ArrayNode"; }
 
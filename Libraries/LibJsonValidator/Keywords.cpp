@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/Function.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibJsonValidator/EnumSet.h>
+#include <LibJsonValidator/Keywords.h>
+#include <LibJsonValidator/Parser.h>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#elif defined(__SSE2__)
+#    include <emmintrin.h>
+#endif
+
+namespace JsonValidator {
+
+size_t count_code_points(const char* characters, size_t length)
+{
+    size_t continuation_bytes = 0;
+    size_t i = 0;
+
+    // Continuation bytes are 0x80-0xbf, which are the signed bytes below -64.
+#if defined(__AVX2__)
+    const __m256i avx_threshold = _mm256_set1_epi8(-64);
+    for (; i + 32 <= length; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(characters + i));
+        continuation_bytes += __builtin_popcount((u32)_mm256_movemask_epi8(_mm256_cmpgt_epi8(avx_threshold, bytes)));
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i sse_threshold = _mm_set1_epi8(-64);
+    for (; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(characters + i));
+        continuation_bytes += __builtin_popcount((u32)_mm_movemask_epi8(_mm_cmplt_epi8(bytes, sse_threshold)));
+    }
+#endif
+    for (; i < length; ++i) {
+        if ((characters[i] & 0xc0) == 0x80)
+            ++continuation_bytes;
+    }
+    return length - continuation_bytes;
+}
+
+// Sorting the item indices by hash touches memory in order, which beats probing a
+// table bigger than the caches on very large arrays.
+static const size_t sort_duplicates_threshold = 1 << 16;
+
+static const JsonValue* find_duplicate_item_by_sorting(const Vector<JsonValue>& values)
+{
+    Vector<u32> hashes;
+    Vector<u32> order;
+    hashes.ensure_capacity(values.size());
+    order.ensure_capacity(values.size());
+    for (u32 i = 0; i < values.size(); ++i) {
+        hashes.append(structural_hash(values[i]));
+        order.append(i);
+    }
+    quick_sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+        if (hashes[a] != hashes[b])
+            return hashes[a] < hashes[b];
+        return a < b;
+    });
+
+    // report the same item as the hash table would: the first one that has an equal item before it
+    size_t duplicate = values.size();
+    for (size_t run = 0; run < order.size();) {
+        size_t run_end = run + 1;
+        while (run_end < order.size() && hashes[order[run_end]] == hashes[order[run]])
+            ++run_end;
+        for (size_t i = run + 1; i < run_end; ++i) {
+            if (order[i] >= duplicate)
+                break;
+            for (size_t j = run; j < i; ++j) {
+                if (values[order[j]].equals(values[order[i]])) {
+                    duplicate = order[i];
+                    break;
+                }
+            }
+        }
+        run = run_end;
+    }
+    return duplicate < values.size() ? &values[duplicate] : nullptr;
+}
+
+const JsonValue* find_duplicate_item(const JsonArray& array)
+{
+    auto& values = array.values();
+    if (values.size() < 2)
+        return nullptr;
+    if (values.size() >= sort_duplicates_threshold)
+        return find_duplicate_item_by_sorting(values);
+
+    // open addressing table of item indices, at most half full
+    static const u32 empty_slot = 0xffffffff;
+    size_t capacity = 8;
+    while (capacity < values.size() * 2)
+        capacity *= 2;
+    Vector<u32> slots;
+    Vector<u32> hashes;
+    slots.ensure_capacity(capacity);
+    for (size_t i = 0; i < capacity; ++i)
+        slots.append(empty_slot);
+    hashes.ensure_capacity(values.size());
+
+    u32 mask = capacity - 1;
+    for (u32 i = 0; i < values.size(); ++i) {
+        u32 hash = structural_hash(values[i]);
+        hashes.append(hash);
+        u32 slot = hash & mask;
+        for (; slots[slot] != empty_slot; slot = (slot + 1) & mask) {
+            u32 other = slots[slot];
+            if (hashes[other] == hash && values[other].equals(values[i]))
+                return &values[i];
+        }
+        slots[slot] = i;
+    }
+    return nullptr;
+}
+
+bool instance_defs_valid(const JsonObject& object)
+{
+    // FIXME: Unclear why this is even in the tests... what's the use case for values to have $defs?
+    Parser p;
+    return p.parse_sub_schema("$defs", object, nullptr, [](auto&, auto&&) {});
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/JsonValue.h>
+#include <LibJsonValidator/Forward.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+
+// Keyword checks shared by the Interpreter and by validators emitted by the Generator.
+
+namespace JsonValidator {
+
+inline TypeMask type_mask_of(const JsonValue& json)
+{
+    switch (json.type()) {
+    case JsonValue::Type::Null:
+        return TypeMaskNull;
+    case JsonValue::Type::Bool:
+        return TypeMaskBoolean;
+    case JsonValue::Type::Object:
+        return TypeMaskObject;
+    case JsonValue::Type::Array:
+        return TypeMaskArray;
+    case JsonValue::Type::String:
+        return TypeMaskString;
+    case JsonValue::Type::Int32:
+    case JsonValue::Type::UnsignedInt32:
+    case JsonValue::Type::Int64:
+    case JsonValue::Type::UnsignedInt64:
+        return TypeMaskInteger;
+    case JsonValue::Type::Double:
+        return TypeMaskNumber;
+    default:
+        return 0;
+    }
+}
+
+inline bool has_type(TypeMask accepted_types, const JsonValue& json)
+{
+    return type_mask_of(json) & accepted_types;
+}
+
+// minLength and maxLength count code points, which are the bytes of UTF-8 text that
+// aren't continuation bytes.
+size_t count_code_points(const char* characters, size_t length);
+
+// A string has at most as many code points as bytes, and at least a quarter as many, so
+// the byte length decides most checks without counting.
+inline bool exceeds_max_length(const String& value, size_t max_length)
+{
+    size_t bytes = value.length();
+    if (bytes <= max_length)
+        return false;
+    if (bytes > 4 * max_length)
+        return true;
+    return count_code_points(value.characters(), bytes) > max_length;
+}
+
+inline bool below_min_length(const String& value, size_t min_length)
+{
+    size_t bytes = value.length();
+    if (bytes < min_length)
+        return true;
+    if (bytes >= 4 * min_length)
+        return false;
+    return count_code_points(value.characters(), bytes) < min_length;
+}
+
+// Returns the first duplicate item, or null if all items are unique.
+const JsonValue* find_duplicate_item(const JsonArray&);
+
+// Checks that $defs embedded in an object instance are valid schemas.
+bool instance_defs_valid(const JsonObject&);
+
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <LibJsonValidator/NumberConstant.h>
+#include <float.h>
+#include <math.h>
+
+namespace JsonValidator {
+
+static const double two_to_the_63 = 9223372036854775808.0;
+static const double two_to_the_64 = 18446744073709551616.0;
+// Doubles at or above this are all integers.
+static const double two_to_the_53 = 9007199254740992.0;
+
+NumberConstant::NumberConstant(double value)
+    : m_value(value)
+{
+    if (value >= two_to_the_63) {
+        m_range = 1;
+    } else if (value < -two_to_the_63) {
+        m_range = -1;
+    } else {
+        double floor_value = floor(value);
+        m_floor = (i64)floor_value;
+        m_is_integral = floor_value == value;
+    }
+    find_decimal_form();
+}
+
+NumberConstant::NumberConstant(i64 value)
+    : m_value((double)value)
+    , m_floor(value)
+{
+    find_decimal_form();
+}
+
+NumberConstant::NumberConstant(u64 value)
+    : m_value((double)value)
+{
+    if (value <= (u64)INT64_MAX) {
+        m_floor = (i64)value;
+    } else {
+        m_range = 1;
+        m_is_large_unsigned = true;
+        m_large_unsigned = value;
+    }
+    find_decimal_form();
+}
+
+NumberConstant NumberConstant::from_json(const JsonValue& json)
+{
+    if (json.is_i32() || json.is_u32() || json.is_i64())
+        return NumberConstant(json.to_number<i64>());
+    if (json.is_u64())
+        return NumberConstant(json.as_u64());
+    return NumberConstant(json.to_number<double>());
+}
+
+static u64 greatest_common_divisor(u64 a, u64 b)
+{
+    while (b) {
+        u64 remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+void NumberConstant::find_decimal_form()
+{
+    if (is_integer()) {
+        // the magnitude, without overflowing on INT64_MIN
+        m_decimal_digits = m_floor < 0 ? (u64)(-(m_floor + 1)) + 1 : (u64)m_floor;
+        m_has_decimal_form = m_decimal_digits != 0;
+    } else if (m_is_large_unsigned) {
+        m_decimal_digits = m_large_unsigned;
+        m_has_decimal_form = true;
+    } else if (m_range == 0) {
+        // The shortest scale at which the digits round to the constant exactly. Dividing
+        // by the power is correctly rounded, so this is the decimal the schema spelled out.
+        double magnitude = fabs(m_value);
+        double power = 1;
+        for (u8 scale = 1; scale <= 17; ++scale) {
+            power *= 10;
+            double digits = nearbyint(magnitude * power);
+            if (digits > two_to_the_53)
+                break;
+            if (digits != 0 && digits / power == magnitude) {
+                m_has_decimal_form = true;
+                m_decimal_scale = scale;
+                m_decimal_digits = (u64)digits;
+                m_decimal_power = power;
+                break;
+            }
+        }
+    }
+
+    if (m_has_decimal_form) {
+        // n * 10^scale has to be a multiple of the digits
+        u64 power_of_ten = 1;
+        for (u8 i = 0; i < m_decimal_scale; ++i)
+            power_of_ten *= 10;
+        m_integer_step = m_decimal_digits / greatest_common_divisor(m_decimal_digits, power_of_ten);
+    }
+}
+
+int NumberConstant::compare_large_unsigned(u64 value) const
+{
+    if (m_range <= 0)
+        return 1;
+    if (m_is_large_unsigned)
+        return value < m_large_unsigned ? -1 : (value > m_large_unsigned ? 1 : 0);
+    if (m_value >= two_to_the_64)
+        return -1;
+    // integral, as every double this large is
+    u64 constant = (u64)m_value;
+    return value < constant ? -1 : (value > constant ? 1 : 0);
+}
+
+bool NumberConstant::divides(const JsonValue& json) const
+{
+    if (m_has_decimal_form) {
+        switch (json.type()) {
+        case JsonValue::Type::Int32:
+        case JsonValue::Type::Int64: {
+            i64 value = json.to_number<i64>();
+            u64 magnitude = value < 0 ? (u64)(-(value + 1)) + 1 : (u64)value;
+            return magnitude % m_integer_step == 0;
+        }
+        case JsonValue::Type::UnsignedInt32:
+        case JsonValue::Type::UnsignedInt64:
+            return json.to_number<u64>() % m_integer_step == 0;
+        default:
+            break;
+        }
+
+        // A multiple has at most as many decimals as the divisor, so scaling by the
+        // divisor's power of ten has to give an integer, up to the rounding of the scaling.
+        double scaled = json.to_number<double>() * m_decimal_power;
+        if (!isfinite(scaled))
+            return false;
+        double rounded = nearbyint(scaled);
+        if (fabs(scaled - rounded) > fabs(scaled) * 4 * DBL_EPSILON)
+            return false;
+        return fmod(rounded, (double)m_decimal_digits) == 0;
+    }
+
+    double quotient = json.to_number<double>() / m_value;
+    if (!isfinite(quotient))
+        return false;
+    return quotient == nearbyint(quotient);
+}
+
+}
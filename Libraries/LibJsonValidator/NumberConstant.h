@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/JsonValue.h>
+#include <stdint.h>
+
+namespace JsonValidator {
+
+// The value of minimum, maximum, exclusiveMinimum, exclusiveMaximum or multipleOf. It is
+// classified once when the schema is compiled, so integer instances are checked with
+// integer arithmetic and never converted to double.
+class NumberConstant {
+public:
+    NumberConstant() = default;
+    explicit NumberConstant(double);
+    explicit NumberConstant(i64);
+    explicit NumberConstant(u64);
+
+    // Integer keyword values stay exact, others become doubles.
+    static NumberConstant from_json(const JsonValue&);
+
+    double value() const { return m_value; }
+    // Whether the constant was an integer that fits an i64, see integer().
+    bool is_integer() const { return m_range == 0 && m_is_integral; }
+    i64 integer() const { return m_floor; }
+    // Whether the constant was an integer above the i64 range, see large_unsigned().
+    bool is_large_unsigned() const { return m_is_large_unsigned; }
+    u64 large_unsigned() const { return m_large_unsigned; }
+
+    // Less than, equal to or greater than zero as the number instance is below, equal to or
+    // above the constant.
+    int compare(const JsonValue& json) const
+    {
+        switch (json.type()) {
+        case JsonValue::Type::Int32:
+            return compare_integer(json.as_i32());
+        case JsonValue::Type::UnsignedInt32:
+            return compare_integer(json.as_u32());
+        case JsonValue::Type::Int64:
+            return compare_integer(json.as_i64());
+        case JsonValue::Type::UnsignedInt64:
+            if (json.as_u64() <= (u64)INT64_MAX)
+                return compare_integer((i64)json.as_u64());
+            return compare_large_unsigned(json.as_u64());
+        default: {
+            double value = json.to_number<double>();
+            return value < m_value ? -1 : (value > m_value ? 1 : 0);
+        }
+        }
+    }
+
+    // multipleOf: whether the number instance is an integer multiple of the constant.
+    bool divides(const JsonValue&) const;
+
+private:
+    int compare_integer(i64 value) const
+    {
+        if (m_range != 0)
+            return -m_range;
+        if (value != m_floor)
+            return value < m_floor ? -1 : 1;
+        return m_is_integral ? 0 : -1;
+    }
+    int compare_large_unsigned(u64) const;
+    void find_decimal_form();
+
+    double m_value { 0 };
+    // floor(m_value) if m_range is 0
+    i64 m_floor { 0 };
+    // -1 below the i64 range, 1 above it, 0 within
+    i8 m_range { 0 };
+    bool m_is_integral { true };
+    // set for integers between INT64_MAX and UINT64_MAX, which a double can't hold exactly
+    bool m_is_large_unsigned { false };
+    u64 m_large_unsigned { 0 };
+
+    // The constant as m_decimal_digits / 10^m_decimal_scale, if it has a short decimal form.
+    // Then an integer is a multiple of it if it is a multiple of m_integer_step.
+    bool m_has_decimal_form { false };
+    u8 m_decimal_scale { 0 };
+    u64 m_decimal_digits { 0 };
+    u64 m_integer_step { 0 };
+    double m_decimal_power { 1 };
+};
+
+}
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/StdLibExtras.h>
+#include <AK/StringBuilder.h>
+#include <LibJsonValidator/Keywords.h>
+#include <LibJsonValidator/Optimizer.h>
+#include <math.h>
+
+namespace JsonValidator {
+
+void Optimizer::run()
+{
+    if (m_program.is_empty())
+        return;
+
+    for (;;) {
+        compute_possible_types();
+
+        m_removed.clear();
+        for (size_t i = 0; i < m_program.m_code.size(); ++i)
+            m_removed.append(false);
+
+        bool changed = false;
+        for (u32 i = 0; i < m_program.subroutine_count(); ++i)
+            changed |= simplify(i);
+        if (!changed)
+            break;
+
+        compact();
+    }
+
+    for (u32 i = 0; i < m_program.subroutine_count(); ++i) {
+        if (is_never_valid(i) && m_program.at(m_program.subroutine(i).entry).opcode != OpCode::Fail)
+            note(i, "no instance can match the keywords of this schema");
+    }
+
+    remove_unreferenced_subroutines();
+
+#ifdef JSON_SCHEMA_DEBUG
+    for (auto& line : m_report)
+        printf("optimizer: %s\n", line.characters());
+#endif
+}
+
+template<typename... Args>
+void Optimizer::note(u32 subroutine, const char* fmt, Args... args)
+{
+    StringBuilder b;
+    b.appendf("sub%u (%s): ", subroutine, m_program.location(subroutine).characters());
+    b.appendf(fmt, args...);
+    m_report.append(b.build());
+}
+
+u32 Optimizer::end_of(u32 subroutine) const
+{
+    u32 pc = m_program.subroutine(subroutine).entry;
+    while (m_program.at(pc).opcode != OpCode::Return)
+        ++pc;
+    return pc;
+}
+
+bool Optimizer::is_always_valid(u32 subroutine) const
+{
+    return m_program.at(m_program.subroutine(subroutine).entry).opcode == OpCode::Return;
+}
+
+static u32 end_of_branches(const Program& program, u32 pc)
+{
+    while (program.at(pc).opcode == OpCode::BeginBranches
+        || program.at(pc).opcode == OpCode::CallBranch
+        || program.at(pc).opcode == OpCode::JumpIfMatches
+        || program.at(pc).opcode == OpCode::TaggedBranches)
+        ++pc;
+    return pc;
+}
+
+void Optimizer::compute_possible_types()
+{
+    m_possible_types.clear();
+    for (size_t i = 0; i < m_program.subroutine_count(); ++i)
+        m_possible_types.append(TypeMaskAny | undefined_instance);
+
+    // Start with every type possible and narrow down until nothing changes, so
+    // recursive subroutines keep what they don't exclude themselves.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (u32 i = 0; i < m_program.subroutine_count(); ++i) {
+            auto possible_types = possible_types_of(i);
+            if (possible_types != m_possible_types[i]) {
+                m_possible_types[i] = possible_types;
+                changed = true;
+            }
+        }
+    }
+}
+
+// The types of the instances an enum item matches. Enums compare numbers by value, so
+// 1 and 1.0 match each other, and only a fraction can't be matched by an integer.
+static TypeMask enum_item_types(const JsonValue& item)
+{
+    if (!item.is_number())
+        return type_mask_of(item);
+    if (item.is_double() && item.as_double() != floor(item.as_double()))
+        return TypeMaskNumber;
+    return TypeMaskInteger | TypeMaskNumber;
+}
+
+Optimizer::PossibleTypes Optimizer::possible_types_of(u32 subroutine) const
+{
+    struct Bound {
+        bool present { false };
+        double value { 0 };
+        bool exclusive { false };
+    };
+
+    PossibleTypes possible = TypeMaskAny | undefined_instance;
+    Bound lower;
+    Bound upper;
+    u32 min_length = 0;
+    u32 max_length = invalid_index;
+    u32 min_items = 0;
+    u32 max_items = invalid_index;
+    u32 min_properties = 0;
+    u32 max_properties = invalid_index;
+
+    auto narrow = [](Bound& bound, double value, bool exclusive, bool is_lower) {
+        bool tighter = !bound.present
+            || (is_lower ? value > bound.value : value < bound.value)
+            || (value == bound.value && exclusive);
+        if (tighter)
+            bound = { true, value, exclusive };
+    };
+
+    // Every instruction of a subroutine runs for an instance that validates: the
+    // only jumps skip code on failure or for instances of another type.
+    u32 end = end_of(subroutine);
+    for (u32 pc = m_program.subroutine(subroutine).entry; pc < end; ++pc) {
+        auto& insn = m_program.at(pc);
+        switch (insn.opcode) {
+        case OpCode::CheckType:
+            possible &= insn.a;
+            break;
+        case OpCode::CheckPresent:
+            possible &= ~undefined_instance;
+            break;
+        case OpCode::Fail:
+            possible = 0;
+            break;
+        case OpCode::Call:
+            possible &= m_possible_types[insn.a];
+            break;
+        case OpCode::BeginBranches: {
+            u32 group_end = end_of_branches(m_program, pc);
+            PossibleTypes branch_types = 0;
+            for (u32 i = pc; i < group_end; ++i) {
+                auto& branch = m_program.at(i);
+                if (branch.opcode == OpCode::TaggedBranches) {
+                    auto& table = m_program.tagged_union_table(branch.a);
+                    for (u32 j = 0; j < table.branches.count; ++j)
+                        branch_types |= m_possible_types[m_program.index(table.branches.first + j)];
+                    continue;
+                }
+                if (branch.opcode != OpCode::CallBranch)
+                    continue;
+                if (m_program.at(group_end).opcode == OpCode::EndNot) {
+                    if (is_always_valid(branch.a))
+                        possible = 0;
+                } else {
+                    branch_types |= m_possible_types[branch.a];
+                }
+            }
+            if (m_program.at(group_end).opcode != OpCode::EndNot)
+                possible &= branch_types;
+            pc = group_end;
+            break;
+        }
+        case OpCode::Enum: {
+            PossibleTypes enum_types = 0;
+            for (auto& item : m_program.enum_set(insn.a).items())
+                enum_types |= enum_item_types(item);
+            possible &= enum_types;
+            break;
+        }
+        case OpCode::Minimum:
+        case OpCode::ExclusiveMinimum:
+            narrow(lower, m_program.number(insn.a).value(), insn.opcode == OpCode::ExclusiveMinimum, true);
+            break;
+        case OpCode::Maximum:
+        case OpCode::ExclusiveMaximum:
+            narrow(upper, m_program.number(insn.a).value(), insn.opcode == OpCode::ExclusiveMaximum, false);
+            break;
+        case OpCode::MinLength:
+            min_length = max(min_length, insn.a);
+            break;
+        case OpCode::MaxLength:
+            max_length = min(max_length, insn.a);
+            break;
+        case OpCode::MinItems:
+            min_items = max(min_items, insn.a);
+            break;
+        case OpCode::MaxItems:
+            max_items = min(max_items, insn.a);
+            break;
+        case OpCode::MinProperties:
+            min_properties = max(min_properties, insn.a);
+            break;
+        case OpCode::MaxProperties:
+            max_properties = min(max_properties, insn.a);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (lower.present && upper.present) {
+        if (lower.value > upper.value || (lower.value == upper.value && (lower.exclusive || upper.exclusive)))
+            possible &= ~(TypeMaskInteger | TypeMaskNumber);
+    }
+    if (min_length > max_length)
+        possible &= ~TypeMaskString;
+    if (min_items > max_items)
+        possible &= ~TypeMaskArray;
+    if (min_properties > max_properties)
+        possible &= ~TypeMaskObject;
+
+    return possible;
+}
+
+u32 Optimizer::next_live(u32 pc) const
+{
+    while (m_removed[pc])
+        ++pc;
+    return pc;
+}
+
+bool Optimizer::simplify(u32 subroutine)
+{
+    bool changed = false;
+    u32 end = end_of(subroutine);
+
+    for (u32 pc = m_program.subroutine(subroutine).entry; pc < end; ++pc) {
+        auto& insn = m_program.at(pc);
+        switch (insn.opcode) {
+        case OpCode::Call:
+        case OpCode::Items:
+            if (is_always_valid(insn.a)) {
+                note(subroutine, "removed %s of sub%u, it accepts every instance", to_string(insn.opcode), insn.a);
+                remove(pc);
+                changed = true;
+            }
+            break;
+        case OpCode::DependentSchema:
+            if (is_always_valid(insn.b)) {
+                note(subroutine, "removed %s of sub%u, it accepts every instance", to_string(insn.opcode), insn.b);
+                remove(pc);
+                changed = true;
+            }
+            break;
+        case OpCode::BeginBranches: {
+            u32 group_end = end_of_branches(m_program, pc);
+            changed |= simplify_branches(subroutine, pc, group_end);
+            pc = group_end;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    changed |= remove_jumps_to_next(subroutine);
+    return changed;
+}
+
+bool Optimizer::simplify_branches(u32 subroutine, u32 begin, u32 end)
+{
+    auto remove_group = [&] {
+        for (u32 pc = begin; pc <= end; ++pc)
+            remove(pc);
+    };
+
+    Vector<u32> branches;
+    for (u32 pc = begin; pc < end; ++pc) {
+        if (m_program.at(pc).opcode == OpCode::CallBranch)
+            branches.append(pc);
+    }
+
+    auto end_opcode = m_program.at(end).opcode;
+
+    if (end_opcode == OpCode::EndNot) {
+        u32 branch = m_program.at(branches[0]).a;
+        if (is_never_valid(branch)) {
+            note(subroutine, "removed not of sub%u, it never matches", branch);
+            remove_group();
+            return true;
+        }
+
+        // not: { not: X } is X
+        u32 entry = m_program.subroutine(branch).entry;
+        if (m_program.at(entry).opcode == OpCode::BeginBranches
+            && m_program.at(entry + 1).opcode == OpCode::CallBranch
+            && m_program.at(entry + 2).opcode == OpCode::EndNot
+            && m_program.at(entry + 3).opcode == OpCode::Return) {
+            u32 inner = m_program.at(entry + 1).a;
+            note(subroutine, "folded double negation of sub%u", inner);
+            remove_group();
+            m_program.m_code[begin] = { OpCode::Call, inner, 0 };
+            m_removed[begin] = false;
+            return true;
+        }
+        return false;
+    }
+
+    if (end_opcode == OpCode::EndAnyOf) {
+        for (auto pc : branches) {
+            if (is_always_valid(m_program.at(pc).a)) {
+                note(subroutine, "removed anyOf, branch sub%u accepts every instance", m_program.at(pc).a);
+                remove_group();
+                return true;
+            }
+        }
+    }
+
+    // Branches that never match don't change the outcome of anyOf or oneOf. One
+    // branch is kept, so that a group without any possible match still fails.
+    bool changed = false;
+    size_t remaining = branches.size();
+    for (auto pc : branches) {
+        if (remaining == 1)
+            break;
+        if (!is_never_valid(m_program.at(pc).a))
+            continue;
+        note(subroutine, "removed %s branch sub%u, it never matches", end_opcode == OpCode::EndAnyOf ? "anyOf" : "oneOf", m_program.at(pc).a);
+        remove(pc);
+        if (m_program.at(pc + 1).opcode == OpCode::JumpIfMatches)
+            remove(pc + 1);
+        --remaining;
+        changed = true;
+    }
+    return changed;
+}
+
+bool Optimizer::remove_jumps_to_next(u32 subroutine)
+{
+    bool changed = false;
+    u32 end = end_of(subroutine);
+    for (u32 pc = m_program.subroutine(subroutine).entry; pc < end; ++pc) {
+        auto& insn = m_program.at(pc);
+        if (m_removed[pc] || (insn.opcode != OpCode::JumpIfNotType && insn.opcode != OpCode::JumpIfMatches))
+            continue;
+        if (next_live(pc + 1) == next_live(insn.b)) {
+            remove(pc);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+void Optimizer::compact()
+{
+    auto& code = m_program.m_code;
+
+    // removed instructions map to the next instruction that is kept
+    Vector<u32> new_pc;
+    Vector<Instruction> new_code;
+    for (size_t pc = 0; pc < code.size(); ++pc) {
+        new_pc.append(new_code.size());
+        if (!m_removed[pc])
+            new_code.append(code[pc]);
+    }
+    new_pc.append(new_code.size());
+
+    for (auto& insn : new_code) {
+        if (is_jump(insn.opcode))
+            insn.b = new_pc[insn.b];
+    }
+    for (auto& subroutine : m_program.m_subroutines)
+        subroutine.entry = new_pc[subroutine.entry];
+
+    code = move(new_code);
+}
+
+void Optimizer::remove_unreferenced_subroutines()
+{
+    Vector<bool> referenced;
+    for (size_t i = 0; i < m_program.subroutine_count(); ++i)
+        referenced.append(false);
+
+    Vector<u32> pending;
+    auto reference = [&](u32 subroutine) {
+        if (subroutine == invalid_index || referenced[subroutine])
+            return;
+        referenced[subroutine] = true;
+        pending.append(subroutine);
+    };
+
+    // Calls every subroutine operand of the instruction, with a reference that may be rewritten.
+    auto for_each_operand = [&](Instruction& insn, auto callback) {
+        switch (insn.opcode) {
+        case OpCode::Call:
+        case OpCode::CallBranch:
+        case OpCode::Items:
+        case OpCode::Contains:
+            callback(insn.a);
+            break;
+        case OpCode::DependentSchema:
+            callback(insn.b);
+            break;
+        case OpCode::Properties: {
+            auto& table = m_program.m_property_tables[insn.a];
+            for (u32 i = 0; i < table.properties.count; ++i)
+                callback(m_program.m_property_entries[table.properties.first + i].subroutine);
+            for (u32 i = 0; i < table.pattern_properties.count; ++i)
+                callback(m_program.m_pattern_properties[table.pattern_properties.first + i].subroutine);
+            callback(table.additional_properties);
+            callback(table.property_names);
+            break;
+        }
+        case OpCode::TupleItems: {
+            auto& table = m_program.m_tuple_tables[insn.a];
+            for (u32 i = 0; i < table.items.count; ++i)
+                callback(m_program.m_indices[table.items.first + i]);
+            callback(table.additional_items);
+            break;
+        }
+        case OpCode::TaggedBranches: {
+            auto& table = m_program.m_tagged_union_tables[insn.a];
+            for (u32 i = 0; i < table.branches.count; ++i)
+                callback(m_program.m_indices[table.branches.first + i]);
+            for (u32 i = 0; i < table.candidates.count; ++i)
+                callback(m_program.m_indices[table.candidates.first + i]);
+            break;
+        }
+        default:
+            break;
+        }
+    };
+
+    reference(0);
+    while (!pending.is_empty()) {
+        u32 subroutine = pending.take_last();
+        u32 end = end_of(subroutine);
+        for (u32 pc = m_program.subroutine(subroutine).entry; pc < end; ++pc)
+            for_each_operand(m_program.m_code[pc], [&](u32& operand) { reference(operand); });
+    }
+
+    Vector<u32> new_index;
+    u32 referenced_count = 0;
+    m_removed.clear();
+    for (size_t i = 0; i < m_program.m_code.size(); ++i)
+        m_removed.append(false);
+
+    for (u32 i = 0; i < m_program.subroutine_count(); ++i) {
+        if (referenced[i]) {
+            new_index.append(referenced_count++);
+            continue;
+        }
+        new_index.append(invalid_index);
+        u32 end = end_of(i);
+        for (u32 pc = m_program.subroutine(i).entry; pc <= end; ++pc)
+            remove(pc);
+    }
+
+    if (referenced_count == m_program.subroutine_count())
+        return;
+
+    m_report.append(String::format("removed %zu unreferenced subroutines", m_program.subroutine_count() - referenced_count));
+
+    // every table belongs to exactly one instruction, so it is rewritten exactly once.
+    for (auto& insn : m_program.m_code) {
+        for_each_operand(insn, [&](u32& operand) {
+            if (operand != invalid_index)
+                operand = new_index[operand];
+        });
+    }
+
+    compact();
+
+    Vector<Subroutine> subroutines;
+    for (u32 i = 0; i < m_program.subroutine_count(); ++i) {
+        if (referenced[i])
+            subroutines.append(m_program.m_subroutines[i]);
+    }
+    m_program.m_subroutines = move(subroutines);
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJsonValidator/Bytecode.h>
+#include <LibJsonValidator/Forward.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+
+namespace JsonValidator {
+
+// Rewrites a compiled Program so that fewer instructions run for every instance:
+// calls of subroutines that accept everything are dropped, anyOf/oneOf/not
+// branches that can never match are removed or decide the whole group, double
+// negations are folded and subroutines that are no longer referenced are removed.
+//
+// A subroutine can never match if the keywords in it contradict each other for
+// every instance type, e.g. minimum > maximum on a number-only schema.
+//
+// Branches of anyOf/oneOf/not only contribute whether they match, so they are
+// rewritten freely. Where the errors of a subroutine are reported, only rewrites
+// that don't change whether an instance is valid are applied.
+class Optimizer {
+public:
+    explicit Optimizer(Program& program)
+        : m_program(program)
+    {
+    }
+
+    void run();
+
+    // One line for every rewrite that was applied. Subroutines are numbered as
+    // before the unreferenced ones were removed.
+    const Vector<String>& report() const { return m_report; }
+
+private:
+    // Instance types (plus undefined_instance) that can possibly match a subroutine.
+    static constexpr u8 undefined_instance = 0x80;
+    typedef u8 PossibleTypes;
+
+    u32 end_of(u32 subroutine) const;
+    bool is_always_valid(u32 subroutine) const;
+    bool is_never_valid(u32 subroutine) const { return !m_possible_types[subroutine]; }
+
+    void compute_possible_types();
+    PossibleTypes possible_types_of(u32 subroutine) const;
+
+    bool simplify(u32 subroutine);
+    bool simplify_branches(u32 subroutine, u32 begin, u32 end);
+    bool remove_jumps_to_next(u32 subroutine);
+    u32 next_live(u32 pc) const;
+    void remove(u32 pc) { m_removed[pc] = true; }
+
+    void compact();
+    void remove_unreferenced_subroutines();
+
+    template<typename... Args>
+    void note(u32 subroutine, const char* fmt, Args... args);
+
+    Program& m_program;
+    Vector<PossibleTypes> m_possible_types;
+    Vector<bool> m_removed;
+    Vector<String> m_report;
+};
+
+}
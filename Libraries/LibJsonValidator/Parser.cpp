@@ -28,12 +28,23 @@
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <LibCore/File.h>
+#include <LibJsonValidator/Compiler.h>
 #include <LibJsonValidator/JsonSchemaNode.h>
+#include <LibJsonValidator/Optimizer.h>
 #include <LibJsonValidator/Parser.h>
+#include <LibJsonValidator/Regex.h>
 #include <stdio.h>
 
 namespace JsonValidator {
 
+// Keyword values are borrowed from the schema, a missing keyword is undefined.
+static const JsonValue& keyword(const JsonObject& object, const String& name)
+{
+    static const JsonValue undefined { JsonValue::Type::Undefined };
+    auto* value = object.get_ptr(name);
+    return value ? *value : undefined;
+}
+
 JsonValue Parser::run(const FILE* fd)
 {
     StringBuilder builder;
@@ -64,11 +75,16 @@ JsonValue Parser::run(const String& filename)
 JsonValue Parser::run(const JsonValue& json)
 {
     m_anchors.clear();
+    m_references.clear();
     m_parser_errors.clear();
+    m_program = nullptr;
+    m_optimizer_report.clear();
 
     if (json.is_bool()) {
         m_root_node = make<BooleanNode>("", json.as_bool());
         m_root_node->set_root({});
+        m_root_node->set_json_pointer({}, "#");
+        compile();
         return JsonValue(true);
     }
 
@@ -81,17 +97,20 @@ JsonValue Parser::run(const JsonValue& json)
     // FIXME: Here, we should load the file given in $schema, and check the $id in the root. This will provide the actual schema version used, that could be located anywhere.
     static String known_schema = "https://json-schema.org/draft/2019-09/schema";
 
-    if (json_object.get("$schema").as_string_or(known_schema) != known_schema) {
+    if (keyword(json_object, "$schema").as_string_or(known_schema) != known_schema) {
         add_parser_error("unknown json schema provided, currently, only \"https://json-schema.org/draft/2019-09/schema\" is allowed for $schema.");
     }
 
-    m_root_node = get_typed_node(json_object);
+    m_root_node = get_typed_node(json);
     if (!m_root_node.ptr()) {
         add_parser_error("root node could not be identified correctly");
     } else {
         m_root_node->set_root({});
-        m_root_node->set_anchors(move(m_anchors));
-        m_root_node->resolve_reference(m_root_node);
+        index_subschemas(*m_root_node, "#");
+        for (auto& anchor : m_anchors)
+            m_references.set(String::format("#%s", anchor.key.characters()), anchor.value);
+        resolve_references(*m_root_node);
+        compile();
     }
 
     if (m_parser_errors.size()) {
@@ -104,6 +123,95 @@ JsonValue Parser::run(const JsonValue& json)
     return JsonValue(true);
 }
 
+void Parser::compile()
+{
+    Compiler compiler;
+    compiler.set_profile(m_profile);
+    m_program = compiler.compile(*m_root_node);
+    if (!compiler.errors().is_empty()) {
+        for (auto& error : compiler.errors())
+            add_parser_error(error);
+        m_program = nullptr;
+        return;
+    }
+
+    Optimizer optimizer(*m_program);
+    optimizer.run();
+    m_optimizer_report = optimizer.report();
+}
+
+void Parser::index_subschemas(JsonSchemaNode& node, const String& json_pointer)
+{
+    node.set_json_pointer({}, json_pointer);
+    m_references.set(json_pointer, &node);
+    if (!node.id().is_empty())
+        m_references.set(node.id(), &node);
+
+    node.for_each_subschema([&](auto& segments, auto& subschema) {
+        index_subschemas(subschema, String::format("%s/%s", json_pointer.characters(), segments.characters()));
+    });
+}
+
+void Parser::resolve_references(JsonSchemaNode& node)
+{
+    if (!node.ref().is_empty()) {
+        auto reference = m_references.get(node.ref());
+        if (reference.has_value())
+            node.set_reference(reference.value());
+#ifdef JSON_SCHEMA_DEBUG
+        else
+            printf("Unresolved $ref: %s\n", node.ref().characters());
+#endif
+    }
+
+    node.for_each_subschema([&](auto&, auto& subschema) {
+        resolve_references(subschema);
+    });
+}
+
+static int hex_digit_value(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F')
+        return ch - 'A' + 10;
+    return -1;
+}
+
+// Percent-decodes a $ref. Decoded '/' and '~' are part of a name, so they are
+// escaped as JSON pointer segments are in the reference index.
+static String decode_reference(const String& ref)
+{
+    if (!ref.contains("%"))
+        return ref;
+
+    StringBuilder b;
+    for (size_t i = 0; i < ref.length(); ++i) {
+        int high = -1;
+        int low = -1;
+        if (ref[i] == '%' && i + 2 < ref.length()) {
+            high = hex_digit_value(ref[i + 1]);
+            low = hex_digit_value(ref[i + 2]);
+        }
+        if (high < 0 || low < 0) {
+            b.append(ref[i]);
+            continue;
+        }
+
+        char ch = (char)(high * 16 + low);
+        if (ch == '/')
+            b.append("~1");
+        else if (ch == '~')
+            b.append("~0");
+        else
+            b.append(ch);
+        i += 2;
+    }
+    return b.build();
+}
+
 void Parser::add_parser_error(const String& error)
 {
     m_parser_errors.append(error);
@@ -114,10 +222,10 @@ bool Parser::parse_sub_schema(const String& property,
     JsonSchemaNode* node,
     Function<void(const String& key, NonnullOwnPtr<JsonSchemaNode>&&)> callback)
 {
-    if (!json_object.has(property))
+    auto& property_value = keyword(json_object, property);
+    if (property_value.is_undefined())
         return true; // subschema is valid, if there is none :-)
 
-    auto property_value = json_object.get_or(property, JsonArray());
     if (property_value.is_array()) {
         auto& property_array = property_value.as_array();
         for (auto& item : property_array.values()) {
@@ -188,28 +296,31 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
 
         if (node) {
             node->set_type_str(type_str);
+            node->set_accepted_types(type_mask_from_string(type_str));
             return node;
         }
         return { nullptr };
 
     } else if (json_value.is_object()) {
         auto& json_object = json_value.as_object();
-        auto id = json_object.get("$id");
-        auto type = json_object.get("type");
+        auto& id = keyword(json_object, "$id");
+        auto& type = keyword(json_object, "type");
 
         String type_str;
+        TypeMask accepted_types = TypeMaskAny;
 
         if (type.is_array()) {
-            node = make<UndefinedNode>(parent);
+            // multiple types don't select a node class, the keywords present do that.
+            accepted_types = 0;
             for (auto& item : type.as_array().values()) {
-                OwnPtr<JsonSchemaNode> child_node = get_typed_node(item.as_string(), node.ptr());
-                if (child_node)
-                    node->append_any_of(child_node.release_nonnull());
+                TypeMask item_type = item.is_string() ? type_mask_from_string(item.as_string()) : 0;
+                if (!item_type) {
+                    add_parser_error("type value invalid");
+                    return { nullptr };
+                }
+                accepted_types |= item_type;
             }
-            return node;
-        }
-
-        if (type.is_string()) {
+        } else if (type.is_string()) {
             type_str = type.as_string();
 
             if (type_str != "" && type_str != "null" && type_str != "boolean" && type_str != "number"
@@ -217,6 +328,8 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                 add_parser_error("type value invalid");
                 return { nullptr };
             }
+            if (!type_str.is_empty())
+                accepted_types = type_mask_from_string(type_str);
         } else if (!type.is_undefined()) {
             add_parser_error("type value type invalid (not string or array)");
             return { nullptr };
@@ -238,27 +351,25 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
             node = make<NumberNode>(parent, id.as_string_or(""));
             NumberNode& number_node = *static_cast<NumberNode*>(node.ptr());
 
-            if (json_object.has("minimum")) {
-                number_node.set_minimum(json_object.get("minimum").to_number<double>());
-            }
+            auto& minimum = keyword(json_object, "minimum");
+            if (!minimum.is_undefined())
+                number_node.set_minimum(NumberConstant::from_json(minimum));
 
-            if (json_object.has("maximum")) {
-                number_node.set_maximum(json_object.get("maximum").to_number<double>());
-            }
+            auto& maximum = keyword(json_object, "maximum");
+            if (!maximum.is_undefined())
+                number_node.set_maximum(NumberConstant::from_json(maximum));
 
-            if (json_object.has("exclusiveMinimum")) {
-                number_node.set_exclusive_minimum(json_object.get("exclusiveMinimum").to_number<double>());
-            }
+            auto& exclusive_minimum = keyword(json_object, "exclusiveMinimum");
+            if (!exclusive_minimum.is_undefined())
+                number_node.set_exclusive_minimum(NumberConstant::from_json(exclusive_minimum));
 
-            if (json_object.has("exclusiveMaximum")) {
-                number_node.set_exclusive_maximum(json_object.get("exclusiveMaximum").to_number<double>());
-            }
+            auto& exclusive_maximum = keyword(json_object, "exclusiveMaximum");
+            if (!exclusive_maximum.is_undefined())
+                number_node.set_exclusive_maximum(NumberConstant::from_json(exclusive_maximum));
 
-            if (json_object.has("multipleOf")) {
-                auto number = json_object.get("multipleOf").to_number<double>();
-                if (number > 0)
-                    number_node.set_multiple_of(number);
-            }
+            auto& multiple_of = keyword(json_object, "multipleOf");
+            if (!multiple_of.is_undefined() && multiple_of.to_number<double>() > 0)
+                number_node.set_multiple_of(NumberConstant::from_json(multiple_of));
 
         } else if (type_str == "array"
             || json_object.has("items")
@@ -274,38 +385,41 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
             node = make<ArrayNode>(parent, id.as_string_or(""));
             auto& array_node = *static_cast<ArrayNode*>(node.ptr());
 
-            auto min_items = json_object.get("minItems");
+            auto& min_items = keyword(json_object, "minItems");
             if (min_items.is_number()) {
                 array_node.set_min_items(min_items.to_number<u32>(0));
             }
 
-            auto max_items = json_object.get("maxItems");
+            auto& max_items = keyword(json_object, "maxItems");
             if (max_items.is_number()) {
                 array_node.set_max_items(max_items.to_number<u32>(0));
             }
 
-            if (json_object.has("uniqueItems")) {
-                if (json_object.get("uniqueItems").is_bool())
-                    array_node.set_unique_items(json_object.get("uniqueItems").as_bool());
+            auto& unique_items = keyword(json_object, "uniqueItems");
+            if (!unique_items.is_undefined()) {
+                if (unique_items.is_bool())
+                    array_node.set_unique_items(unique_items.as_bool());
                 else {
                     add_parser_error("uniqueItems value is not a bool");
                 }
             }
 
-            if (json_object.has("additionalItems")) {
-                OwnPtr<JsonSchemaNode> child_node = get_typed_node(json_object.get("additionalItems"), node.ptr());
+            auto& additional_items = keyword(json_object, "additionalItems");
+            if (!additional_items.is_undefined()) {
+                OwnPtr<JsonSchemaNode> child_node = get_typed_node(additional_items, node.ptr());
                 if (child_node)
                     array_node.set_additional_items(child_node.release_nonnull());
             }
 
-            if (json_object.has("contains")) {
-                OwnPtr<JsonSchemaNode> child_node = get_typed_node(json_object.get("contains"), node.ptr());
+            auto& contains = keyword(json_object, "contains");
+            if (!contains.is_undefined()) {
+                OwnPtr<JsonSchemaNode> child_node = get_typed_node(contains, node.ptr());
                 if (child_node)
                     array_node.set_contains(child_node.release_nonnull());
             }
 
-            if (json_object.has("items")) {
-                auto items = json_object.get_or("items", JsonObject());
+            auto& items = keyword(json_object, "items");
+            if (!items.is_undefined()) {
                 if (!items.is_object() && !items.is_array() && !items.is_bool()) {
                     StringBuilder b;
                     b.appendf("items value is not a json object/array/bool, it is: %s", items.to_string().characters());
@@ -313,8 +427,7 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                 }
 
                 if (items.is_object()) {
-                    auto& items_object = items.as_object();
-                    OwnPtr<JsonSchemaNode> child_node = get_typed_node(items_object, node.ptr());
+                    OwnPtr<JsonSchemaNode> child_node = get_typed_node(items, node.ptr());
                     if (child_node)
                         array_node.append_item(child_node.release_nonnull());
                 } else if (items.is_array()) {
@@ -340,15 +453,17 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
 
             node = make<StringNode>(parent, id.as_string_or(""));
 
-            auto pattern = json_object.get("pattern");
+            auto& pattern = keyword(json_object, "pattern");
             if (!pattern.is_undefined()) {
                 if (!pattern.is_string()) {
                     add_parser_error("pattern value is not a json string");
+                } else if (!Regex(pattern.as_string()).is_supported()) {
+                    add_parser_error(String::format("pattern \"%s\" is invalid or not supported", pattern.as_string().characters()));
                 } else {
                     static_cast<StringNode*>(node.ptr())->set_pattern(pattern.as_string());
                 }
             }
-            auto minLength = json_object.get("minLength");
+            auto& minLength = keyword(json_object, "minLength");
             if (!minLength.is_undefined()) {
                 if (!(minLength.is_u32() || minLength.is_u64())) {
                     add_parser_error("minLength value is not a non-negative integer");
@@ -356,7 +471,7 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                     static_cast<StringNode*>(node.ptr())->set_min_length(minLength.to_u32());
                 }
             }
-            auto maxLength = json_object.get("maxLength");
+            auto& maxLength = keyword(json_object, "maxLength");
             if (!maxLength.is_undefined()) {
                 if (!(maxLength.is_u32() || maxLength.is_u64())) {
                     add_parser_error("maxLength value is not a non-negative integer");
@@ -383,10 +498,10 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                 node = make<ObjectNode>(parent, id.as_string_or(""));
                 auto& obj_node = *static_cast<ObjectNode*>(node.ptr());
 
-                auto properties = json_object.get_or("properties", JsonObject());
-                if (!properties.is_object()) {
+                auto& properties = keyword(json_object, "properties");
+                if (!properties.is_undefined() && !properties.is_object()) {
                     add_parser_error("properties value is not a json object");
-                } else {
+                } else if (properties.is_object()) {
 
                     properties.as_object().for_each_member([&](auto& key, auto& json_value) {
                         OwnPtr<JsonSchemaNode> child_node = get_typed_node(json_value, node.ptr());
@@ -395,47 +510,51 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                     });
                 }
 
-                auto min_properties = json_object.get("minProperties");
+                auto& min_properties = keyword(json_object, "minProperties");
                 if (min_properties.is_number()) {
                     obj_node.set_min_properties(min_properties.to_number<u32>(0));
                 }
 
-                auto max_properties = json_object.get("maxProperties");
+                auto& max_properties = keyword(json_object, "maxProperties");
                 if (max_properties.is_number()) {
                     obj_node.set_max_properties(max_properties.to_number<u32>(0));
                 }
 
-                auto pattern_properties = json_object.get_or("patternProperties", JsonObject());
-                if (!properties.is_object()) {
+                auto& pattern_properties = keyword(json_object, "patternProperties");
+                if (!pattern_properties.is_undefined() && !pattern_properties.is_object()) {
                     add_parser_error("patternProperties value is not a json object");
-                } else {
+                } else if (pattern_properties.is_object()) {
                     pattern_properties.as_object().for_each_member([&](auto& key, auto& json_value) {
+                        if (!Regex(key).is_supported()) {
+                            add_parser_error(String::format("patternProperties pattern \"%s\" is invalid or not supported", key.characters()));
+                            return;
+                        }
                         OwnPtr<JsonSchemaNode> child_node = get_typed_node(json_value, node.ptr());
                         if (child_node) {
-                            child_node->compile_pattern(key);
+                            child_node->set_property_pattern(key);
                             obj_node.append_pattern_property(child_node.release_nonnull());
                         }
                     });
                 }
 
-                auto additional_properties = json_object.get("additionalProperties");
+                auto& additional_properties = keyword(json_object, "additionalProperties");
                 if (!additional_properties.is_undefined()) {
                     OwnPtr<JsonSchemaNode> child_node = get_typed_node(additional_properties, node.ptr());
                     if (child_node)
                         obj_node.set_additional_properties(child_node.release_nonnull());
                 }
 
-                auto property_names = json_object.get("propertyNames");
+                auto& property_names = keyword(json_object, "propertyNames");
                 if (!property_names.is_undefined()) {
                     OwnPtr<JsonSchemaNode> child_node = get_typed_node(property_names, node.ptr());
                     if (child_node)
                         obj_node.set_property_names(child_node.release_nonnull());
                 }
 
-                auto required = json_object.get_or("required", JsonArray());
-                if (!required.is_array()) {
+                auto& required = keyword(json_object, "required");
+                if (!required.is_undefined() && !required.is_array()) {
                     add_parser_error("required value is not a json array");
-                } else {
+                } else if (required.is_array()) {
                     for (auto& required_property : required.as_array().values()) {
 
                         if (!required_property.is_string()) {
@@ -452,7 +571,7 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                     }
                 }
 
-                auto dependent_required = json_object.get("dependentRequired");
+                auto& dependent_required = keyword(json_object, "dependentRequired");
                 if (!dependent_required.is_undefined()) {
                     if (!dependent_required.is_object()) {
                         add_parser_error("dependentRequired value is not a json object");
@@ -478,7 +597,7 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                     }
                 }
 
-                auto dependent_schemas = json_object.get("dependentSchemas");
+                auto& dependent_schemas = keyword(json_object, "dependentSchemas");
                 if (!dependent_schemas.is_undefined()) {
                     if (!dependent_schemas.is_object()) {
                         add_parser_error("dependentSchemas value is not a json object");
@@ -511,17 +630,17 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                 node->append_defs(key, move(child_node));
             });
 
-            auto ref = json_object.get("$ref");
+            auto& ref = keyword(json_object, "$ref");
             if (ref.is_string() && !ref.as_string().is_empty()) {
-                node->set_ref(ref.as_string());
+                node->set_ref(decode_reference(ref.as_string()));
             }
 
-            auto default_value = json_object.get("default");
+            auto& default_value = keyword(json_object, "default");
             if (!default_value.is_undefined())
                 node->set_default_value(default_value);
 
-            auto enum_value = json_object.get("enum");
-            auto const_value = json_object.get("const");
+            auto& enum_value = keyword(json_object, "enum");
+            auto& const_value = keyword(json_object, "const");
             if (enum_value.is_array()) {
                 for (auto& item : enum_value.as_array().values()) {
                     if (!node->append_enum_item(item)) {
@@ -532,18 +651,30 @@ OwnPtr<JsonSchemaNode> Parser::get_typed_node(const JsonValue& json_value, JsonS
                 node->append_enum_item(const_value);
             }
 
+            // format only applies to strings, but may sit next to the keywords of any type
+            auto& format = keyword(json_object, "format");
+            if (m_assert_formats && format.is_string()) {
+                // unknown formats stay annotations
+                auto known_format = format_from_string(format.as_string());
+                if (known_format.has_value())
+                    node->set_format(known_format.value());
+            }
+
             node->set_type_str(type_str);
+            node->set_accepted_types(accepted_types);
 
-            auto not_ = json_object.get("not");
+            auto& not_ = keyword(json_object, "not");
             if (!not_.is_undefined()) {
                 OwnPtr<JsonSchemaNode> child_node = get_typed_node(not_, node.ptr());
                 if (child_node)
                     node->set_not(child_node.release_nonnull());
             }
 
-            auto anchor = json_object.get("$anchor");
+            auto& anchor = keyword(json_object, "$anchor");
             if (anchor.is_string()) {
+#ifdef JSON_SCHEMA_DEBUG
                 printf("Found anchor: %s\n", anchor.as_string().characters());
+#endif
                 m_anchors.set(anchor.as_string(), node);
             }
         }
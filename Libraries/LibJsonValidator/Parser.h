@@ -29,6 +29,7 @@
 #include <AK/HashMap.h>
 #include <AK/JsonValue.h>
 #include <AK/OwnPtr.h>
+#include <LibJsonValidator/Bytecode.h>
 #include <LibJsonValidator/Forward.h>
 #include <stdio.h>
 
@@ -45,7 +46,16 @@ public:
     JsonValue run(const String& filename);
     JsonValue run(const JsonValue& json);
 
+    // Asserts the formats listed in Format.h. Otherwise format is only an annotation.
+    void set_assert_formats(bool assert_formats) { m_assert_formats = assert_formats; }
+    bool assert_formats() const { return m_assert_formats; }
+    // Orders anyOf/oneOf branches by how likely and cheap they were in the profile.
+    void set_profile(const Profile* profile) { m_profile = profile; }
+
     const OwnPtr<JsonSchemaNode>& root_node() const { return m_root_node; }
+    const OwnPtr<Program>& program() const { return m_program; }
+    // What the optimizer removed from the program.
+    const Vector<String>& optimizer_report() const { return m_optimizer_report; }
 
     bool parse_sub_schema(const String& property,
         const JsonObject& json_object,
@@ -54,11 +64,21 @@ public:
 
 private:
     OwnPtr<JsonSchemaNode> m_root_node;
+    OwnPtr<Program> m_program;
+    Vector<String> m_optimizer_report;
+    bool m_assert_formats { false };
+    const Profile* m_profile { nullptr };
+    void compile();
     OwnPtr<JsonSchemaNode> get_typed_node(const JsonValue&, JsonSchemaNode* parent = nullptr);
 
+    void index_subschemas(JsonSchemaNode&, const String& json_pointer);
+    void resolve_references(JsonSchemaNode&);
+
     void add_parser_error(const String&);
     Vector<String> m_parser_errors;
 
     HashMap<String, JsonSchemaNode*> m_anchors;
+    // Every location a $ref can point to: JSON pointers of all subschemas, #anchors and $ids.
+    HashMap<String, JsonSchemaNode*> m_references;
 };
 }
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/JsonObject.h>
+#include <LibCore/File.h>
+#include <LibJsonValidator/Profile.h>
+#include <stdio.h>
+
+namespace JsonValidator {
+
+Profile::BranchStatistics& Profile::statistics_for(const String& location)
+{
+    auto it = m_branches.find(location);
+    if (it == m_branches.end()) {
+        m_branches.set(location, {});
+        it = m_branches.find(location);
+    }
+    return it->value;
+}
+
+void Profile::record_branch(const String& location, bool matched, u64 cost)
+{
+    auto& statistics = statistics_for(location);
+    ++statistics.evaluations;
+    if (matched)
+        ++statistics.matches;
+    statistics.cost += cost;
+}
+
+const Profile::BranchStatistics* Profile::branch(const String& location) const
+{
+    auto it = m_branches.find(location);
+    if (it == m_branches.end())
+        return nullptr;
+    return &it->value;
+}
+
+JsonValue Profile::to_json() const
+{
+    JsonObject branches;
+    for (auto& it : m_branches) {
+        JsonObject statistics;
+        statistics.set("evaluations", it.value.evaluations);
+        statistics.set("matches", it.value.matches);
+        statistics.set("cost", it.value.cost);
+        branches.set(it.key, statistics);
+    }
+    JsonObject profile;
+    profile.set("branches", branches);
+    return profile;
+}
+
+// Counts are non-negative integers.
+static bool read_count(const JsonObject& object, const char* name, u64& count)
+{
+    auto value = object.get(name);
+    if (value.is_i32() && value.as_i32() >= 0)
+        count = value.as_i32();
+    else if (value.is_i64() && value.as_i64() >= 0)
+        count = value.as_i64();
+    else if (value.is_u32())
+        count = value.as_u32();
+    else if (value.is_u64())
+        count = value.as_u64();
+    else
+        return false;
+    return true;
+}
+
+bool Profile::load(const JsonValue& json)
+{
+    if (!json.is_object() || !json.as_object().get("branches").is_object())
+        return false;
+
+    // nothing is added unless every branch is well-formed
+    HashMap<String, BranchStatistics> loaded;
+    bool valid = true;
+    json.as_object().get("branches").as_object().for_each_member([&](auto& location, auto& value) {
+        BranchStatistics statistics;
+        if (!valid || !value.is_object()
+            || !read_count(value.as_object(), "evaluations", statistics.evaluations)
+            || !read_count(value.as_object(), "matches", statistics.matches)
+            || !read_count(value.as_object(), "cost", statistics.cost)
+            || statistics.matches > statistics.evaluations) {
+            valid = false;
+            return;
+        }
+        loaded.set(location, statistics);
+    });
+    if (!valid)
+        return false;
+
+    for (auto& it : loaded) {
+        auto& statistics = statistics_for(it.key);
+        statistics.evaluations += it.value.evaluations;
+        statistics.matches += it.value.matches;
+        statistics.cost += it.value.cost;
+    }
+    return true;
+}
+
+bool Profile::load_file(const String& filename)
+{
+    auto file = Core::File::construct(filename);
+    if (!file->open(Core::IODevice::ReadOnly)) {
+        fprintf(stderr, "Couldn't open %s for reading: %s\n", filename.characters(), file->error_string());
+        return false;
+    }
+    if (!load(JsonValue::from_string(file->read_all()))) {
+        fprintf(stderr, "%s is not a valid profile\n", filename.characters());
+        return false;
+    }
+    return true;
+}
+
+bool Profile::save_file(const String& filename) const
+{
+    auto file = Core::File::construct(filename);
+    if (!file->open(Core::IODevice::WriteOnly)) {
+        fprintf(stderr, "Couldn't open %s for writing: %s\n", filename.characters(), file->error_string());
+        return false;
+    }
+    return file->write(to_json().to_string());
+}
+
+}
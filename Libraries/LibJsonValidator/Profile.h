@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/JsonValue.h>
+#include <AK/String.h>
+
+namespace JsonValidator {
+
+// How often the branches of anyOf and oneOf matched and how much they cost, as recorded
+// by the Interpreter. The Compiler uses a profile to try the branches that are likely
+// to match and cheap to evaluate first. Branches are keyed by the JSON pointer of their
+// subschema, so a profile stays valid for every compilation of the same schema.
+class Profile {
+public:
+    struct BranchStatistics {
+        u64 evaluations { 0 };
+        u64 matches { 0 };
+        // instructions executed for the branch, including the subroutines it called
+        u64 cost { 0 };
+    };
+
+    void record_branch(const String& location, bool matched, u64 cost);
+    // Null if the branch was never evaluated.
+    const BranchStatistics* branch(const String& location) const;
+
+    bool is_empty() const { return m_branches.is_empty(); }
+
+    JsonValue to_json() const;
+    // Adds the statistics of a profile written by to_json(); a malformed profile is rejected as a whole.
+    bool load(const JsonValue&);
+    bool load_file(const String& filename);
+    bool save_file(const String& filename) const;
+
+private:
+    BranchStatistics& statistics_for(const String& location);
+
+    HashMap<String, BranchStatistics> m_branches;
+};
+
+}
@@ -0,0 +1,1126 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/HashFunctions.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibJsonValidator/Regex.h>
+#include <string.h>
+
+namespace JsonValidator {
+
+static const u32 invalid_node = 0xffffffff;
+static const u32 unbounded = 0xffffffff;
+static const u32 max_code_point = 0x10ffff;
+static const u32 max_repetition = 1000;
+static const u32 max_group_depth = 256;
+static const size_t max_nfa_states = 20000;
+static const u32 unknown_dfa_state = 0xffffffff;
+
+enum class RegexNodeType {
+    Empty,
+    Class,
+    Concatenation,
+    Alternation,
+    Repetition,
+    AssertBegin,
+    AssertEnd,
+};
+
+struct RegexNode {
+    RegexNodeType type { RegexNodeType::Empty };
+    // Class, sorted and merged
+    Vector<CodePointRange> ranges;
+    // Concatenation, Alternation and the child of Repetition
+    Vector<u32> children;
+    u32 min { 0 };
+    u32 max { 0 };
+};
+
+static void normalize(Vector<CodePointRange>& ranges)
+{
+    quick_sort(ranges.begin(), ranges.end(), [](auto& a, auto& b) { return a.first < b.first; });
+    Vector<CodePointRange> merged;
+    for (auto& range : ranges) {
+        if (!merged.is_empty() && range.first <= merged.last().last + 1) {
+            if (range.last > merged.last().last)
+                merged.last().last = range.last;
+        } else {
+            merged.append(range);
+        }
+    }
+    ranges = move(merged);
+}
+
+static void complement(Vector<CodePointRange>& ranges)
+{
+    normalize(ranges);
+    Vector<CodePointRange> complemented;
+    u32 next = 0;
+    for (auto& range : ranges) {
+        if (range.first > next)
+            complemented.append({ next, range.first - 1 });
+        next = range.last + 1;
+    }
+    if (next <= max_code_point)
+        complemented.append({ next, max_code_point });
+    ranges = move(complemented);
+}
+
+static void append_digit_class(Vector<CodePointRange>& ranges)
+{
+    ranges.append({ '0', '9' });
+}
+
+static void append_word_class(Vector<CodePointRange>& ranges)
+{
+    ranges.append({ '0', '9' });
+    ranges.append({ 'A', 'Z' });
+    ranges.append({ '_', '_' });
+    ranges.append({ 'a', 'z' });
+}
+
+static void append_space_class(Vector<CodePointRange>& ranges)
+{
+    // WhiteSpace and LineTerminator of ECMA-262
+    ranges.append({ 0x09, 0x0d });
+    ranges.append({ 0x20, 0x20 });
+    ranges.append({ 0xa0, 0xa0 });
+    ranges.append({ 0x1680, 0x1680 });
+    ranges.append({ 0x2000, 0x200a });
+    ranges.append({ 0x2028, 0x2029 });
+    ranges.append({ 0x202f, 0x202f });
+    ranges.append({ 0x205f, 0x205f });
+    ranges.append({ 0x3000, 0x3000 });
+    ranges.append({ 0xfeff, 0xfeff });
+}
+
+static int hex_digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// A recursive descent parser for the pattern syntax, including the web compatibility
+// rules of Annex B that treat stray braces and unknown escapes as literals.
+class RegexParser {
+public:
+    RegexParser(const String& pattern, Vector<RegexNode>& nodes)
+        : m_pattern(pattern)
+        , m_nodes(nodes)
+    {
+    }
+
+    // Returns the root node, or invalid_node for errors and unsupported syntax.
+    u32 parse()
+    {
+        u32 root = parse_alternation();
+        if (m_offset != m_pattern.length())
+            m_error = true;
+        return m_error ? invalid_node : root;
+    }
+
+private:
+    bool at_end() const { return m_offset >= m_pattern.length(); }
+    char peek(size_t ahead = 0) const { return m_offset + ahead < m_pattern.length() ? m_pattern[m_offset + ahead] : 0; }
+
+    bool consume(char c)
+    {
+        if (at_end() || peek() != c)
+            return false;
+        ++m_offset;
+        return true;
+    }
+
+    u32 add(RegexNodeType type)
+    {
+        RegexNode node;
+        node.type = type;
+        m_nodes.append(move(node));
+        return m_nodes.size() - 1;
+    }
+
+    u32 add_class(Vector<CodePointRange>&& ranges)
+    {
+        normalize(ranges);
+        u32 node = add(RegexNodeType::Class);
+        m_nodes[node].ranges = move(ranges);
+        return node;
+    }
+
+    u32 parse_alternation()
+    {
+        Vector<u32> alternatives;
+        alternatives.append(parse_concatenation());
+        while (!m_error && consume('|'))
+            alternatives.append(parse_concatenation());
+        if (alternatives.size() == 1)
+            return alternatives[0];
+
+        u32 node = add(RegexNodeType::Alternation);
+        m_nodes[node].children = move(alternatives);
+        return node;
+    }
+
+    u32 parse_concatenation()
+    {
+        Vector<u32> items;
+        while (!m_error && !at_end() && peek() != '|' && peek() != ')') {
+            // a quantifier on a bare assertion is an error, on a group of one it isn't
+            bool assertion = peek() == '^' || peek() == '$';
+            u32 atom = parse_atom();
+            if (m_error)
+                return invalid_node;
+            items.append(parse_quantifier(atom, assertion));
+        }
+        if (items.is_empty())
+            return add(RegexNodeType::Empty);
+        if (items.size() == 1)
+            return items[0];
+
+        u32 node = add(RegexNodeType::Concatenation);
+        m_nodes[node].children = move(items);
+        return node;
+    }
+
+    bool parse_braces(u32& min, u32& max)
+    {
+        size_t start = m_offset;
+        if (!consume('{'))
+            return false;
+
+        auto parse_number = [&](u32& number) {
+            if (!(peek() >= '0' && peek() <= '9'))
+                return false;
+            number = 0;
+            while (peek() >= '0' && peek() <= '9') {
+                number = number * 10 + (peek() - '0');
+                if (number > max_repetition)
+                    number = max_repetition + 1;
+                ++m_offset;
+            }
+            return true;
+        };
+
+        if (parse_number(min)) {
+            max = min;
+            if (consume(',')) {
+                if (!parse_number(max))
+                    max = unbounded;
+            }
+            if (consume('}'))
+                return true;
+        }
+        m_offset = start;
+        return false;
+    }
+
+    u32 parse_quantifier(u32 atom, bool assertion)
+    {
+        u32 min = 0;
+        u32 max = 0;
+        if (consume('*')) {
+            max = unbounded;
+        } else if (consume('+')) {
+            min = 1;
+            max = unbounded;
+        } else if (consume('?')) {
+            max = 1;
+        } else if (!parse_braces(min, max)) {
+            return atom;
+        }
+
+        // lazy quantifiers match the same strings
+        consume('?');
+
+        if (assertion || min > max
+            || min > max_repetition || (max != unbounded && max > max_repetition)
+            || peek() == '*' || peek() == '+' || peek() == '?') {
+            m_error = true;
+            return invalid_node;
+        }
+
+        u32 node = add(RegexNodeType::Repetition);
+        m_nodes[node].children.append(atom);
+        m_nodes[node].min = min;
+        m_nodes[node].max = max;
+        return node;
+    }
+
+    u32 parse_atom()
+    {
+        switch (peek()) {
+        case '^':
+            ++m_offset;
+            return add(RegexNodeType::AssertBegin);
+        case '$':
+            ++m_offset;
+            return add(RegexNodeType::AssertEnd);
+        case '.': {
+            ++m_offset;
+            Vector<CodePointRange> ranges;
+            ranges.append({ '\n', '\n' });
+            ranges.append({ '\r', '\r' });
+            ranges.append({ 0x2028, 0x2029 });
+            complement(ranges);
+            return add_class(move(ranges));
+        }
+        case '(':
+            return parse_group();
+        case '[':
+            return parse_class();
+        case '*':
+        case '+':
+        case '?':
+            m_error = true;
+            return invalid_node;
+        case '{': {
+            u32 min;
+            u32 max;
+            if (parse_braces(min, max)) {
+                m_error = true;
+                return invalid_node;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        Vector<CodePointRange> ranges;
+        if (!parse_class_atom(ranges, false))
+            return invalid_node;
+        return add_class(move(ranges));
+    }
+
+    u32 parse_group()
+    {
+        ++m_offset;
+        if (consume('?')) {
+            if (consume('<') && peek() != '=' && peek() != '!') {
+                // named groups are matched like any other group
+                while (!at_end() && peek() != '>')
+                    ++m_offset;
+                if (!consume('>')) {
+                    m_error = true;
+                    return invalid_node;
+                }
+            } else if (!consume(':')) {
+                // lookaround
+                m_error = true;
+                return invalid_node;
+            }
+        }
+
+        if (++m_depth > max_group_depth) {
+            m_error = true;
+            return invalid_node;
+        }
+        u32 node = parse_alternation();
+        --m_depth;
+        if (m_error || !consume(')')) {
+            m_error = true;
+            return invalid_node;
+        }
+        return node;
+    }
+
+    u32 parse_class()
+    {
+        ++m_offset;
+        bool negated = consume('^');
+        Vector<CodePointRange> ranges;
+        for (;;) {
+            if (at_end()) {
+                m_error = true;
+                return invalid_node;
+            }
+            if (consume(']'))
+                break;
+
+            Vector<CodePointRange> first;
+            if (!parse_class_atom(first, true))
+                return invalid_node;
+            bool single = first.size() == 1 && first[0].first == first[0].last;
+            if (single && peek() == '-' && peek(1) && peek(1) != ']') {
+                ++m_offset;
+                Vector<CodePointRange> last;
+                if (!parse_class_atom(last, true))
+                    return invalid_node;
+                if (last.size() == 1 && last[0].first == last[0].last) {
+                    if (first[0].first > last[0].first) {
+                        m_error = true;
+                        return invalid_node;
+                    }
+                    ranges.append({ first[0].first, last[0].first });
+                    continue;
+                }
+                // a range with a class escape is a literal '-' in Annex B
+                ranges.append(first[0]);
+                ranges.append({ '-', '-' });
+                for (auto& range : last)
+                    ranges.append(range);
+                continue;
+            }
+            for (auto& range : first)
+                ranges.append(range);
+        }
+
+        if (negated)
+            complement(ranges);
+        return add_class(move(ranges));
+    }
+
+    bool decode_code_point(u32& code_point)
+    {
+        u8 lead = peek();
+        size_t length = 1;
+        if (lead < 0x80) {
+            code_point = lead;
+        } else if ((lead & 0xe0) == 0xc0) {
+            code_point = lead & 0x1f;
+            length = 2;
+        } else if ((lead & 0xf0) == 0xe0) {
+            code_point = lead & 0x0f;
+            length = 3;
+        } else if ((lead & 0xf8) == 0xf0) {
+            code_point = lead & 0x07;
+            length = 4;
+        } else {
+            return false;
+        }
+        for (size_t i = 1; i < length; ++i) {
+            u8 continuation = peek(i);
+            if ((continuation & 0xc0) != 0x80)
+                return false;
+            code_point = (code_point << 6) | (continuation & 0x3f);
+        }
+        m_offset += length;
+        return true;
+    }
+
+    bool parse_hex(size_t digits, u32& value)
+    {
+        value = 0;
+        for (size_t i = 0; i < digits; ++i) {
+            int digit = hex_digit_value(peek(i));
+            if (digit < 0)
+                return false;
+            value = value * 16 + digit;
+        }
+        m_offset += digits;
+        return true;
+    }
+
+    // Parses a literal character or an escape, in a class or outside of one.
+    bool parse_class_atom(Vector<CodePointRange>& ranges, bool in_class)
+    {
+        u32 code_point = 0;
+        if (!consume('\\')) {
+            if (!decode_code_point(code_point)) {
+                m_error = true;
+                return false;
+            }
+            ranges.append({ code_point, code_point });
+            return true;
+        }
+
+        if (at_end()) {
+            m_error = true;
+            return false;
+        }
+
+        char c = peek();
+        ++m_offset;
+        switch (c) {
+        case 'd':
+        case 'D':
+        case 'w':
+        case 'W':
+        case 's':
+        case 'S': {
+            Vector<CodePointRange> escape_ranges;
+            if (c == 'd' || c == 'D')
+                append_digit_class(escape_ranges);
+            else if (c == 'w' || c == 'W')
+                append_word_class(escape_ranges);
+            else
+                append_space_class(escape_ranges);
+            if (c == 'D' || c == 'W' || c == 'S')
+                complement(escape_ranges);
+            for (auto& range : escape_ranges)
+                ranges.append(range);
+            return true;
+        }
+        case 'b':
+            if (!in_class) {
+                m_error = true;
+                return false;
+            }
+            code_point = 0x08;
+            break;
+        case 'B':
+        case 'k':
+            m_error = true;
+            return false;
+        case '0':
+            if (peek() >= '0' && peek() <= '9') {
+                m_error = true;
+                return false;
+            }
+            code_point = 0;
+            break;
+        case 't':
+            code_point = '\t';
+            break;
+        case 'n':
+            code_point = '\n';
+            break;
+        case 'v':
+            code_point = '\v';
+            break;
+        case 'f':
+            code_point = '\f';
+            break;
+        case 'r':
+            code_point = '\r';
+            break;
+        case 'c':
+            if (!((peek() >= 'a' && peek() <= 'z') || (peek() >= 'A' && peek() <= 'Z'))) {
+                m_error = true;
+                return false;
+            }
+            code_point = peek() % 32;
+            ++m_offset;
+            break;
+        case 'x':
+            if (!parse_hex(2, code_point))
+                code_point = 'x';
+            break;
+        case 'u':
+            if (!parse_hex(4, code_point)) {
+                code_point = 'u';
+            } else if (code_point >= 0xd800 && code_point <= 0xdbff && peek() == '\\' && peek(1) == 'u') {
+                size_t start = m_offset;
+                m_offset += 2;
+                u32 low;
+                if (parse_hex(4, low) && low >= 0xdc00 && low <= 0xdfff)
+                    code_point = 0x10000 + ((code_point - 0xd800) << 10) + (low - 0xdc00);
+                else
+                    m_offset = start;
+            }
+            break;
+        default:
+            if (c >= '1' && c <= '9') {
+                // backreferences
+                m_error = true;
+                return false;
+            }
+            --m_offset;
+            if (!decode_code_point(code_point)) {
+                m_error = true;
+                return false;
+            }
+            break;
+        }
+        ranges.append({ code_point, code_point });
+        return true;
+    }
+
+    String m_pattern;
+    Vector<RegexNode>& m_nodes;
+    size_t m_offset { 0 };
+    u32 m_depth { 0 };
+    bool m_error { false };
+};
+
+static size_t encode_utf8(u32 code_point, u8* bytes)
+{
+    if (code_point < 0x80) {
+        bytes[0] = code_point;
+        return 1;
+    }
+    if (code_point < 0x800) {
+        bytes[0] = 0xc0 | (code_point >> 6);
+        bytes[1] = 0x80 | (code_point & 0x3f);
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        bytes[0] = 0xe0 | (code_point >> 12);
+        bytes[1] = 0x80 | ((code_point >> 6) & 0x3f);
+        bytes[2] = 0x80 | (code_point & 0x3f);
+        return 3;
+    }
+    bytes[0] = 0xf0 | (code_point >> 18);
+    bytes[1] = 0x80 | ((code_point >> 12) & 0x3f);
+    bytes[2] = 0x80 | ((code_point >> 6) & 0x3f);
+    bytes[3] = 0x80 | (code_point & 0x3f);
+    return 4;
+}
+
+// Splits a code point range into sequences of byte ranges, so that the UTF-8 encodings of
+// the code points are exactly the byte strings matched by one of the sequences.
+template<typename Callback>
+static void for_each_utf8_sequence(u32 first, u32 last, Callback callback)
+{
+    if (first > last)
+        return;
+
+    static const u32 boundaries[] = { 0x7f, 0x7ff, 0xffff };
+    for (auto boundary : boundaries) {
+        if (first <= boundary && last > boundary) {
+            for_each_utf8_sequence(first, boundary, callback);
+            for_each_utf8_sequence(boundary + 1, last, callback);
+            return;
+        }
+    }
+
+    u8 first_bytes[4];
+    u8 last_bytes[4];
+    size_t length = encode_utf8(first, first_bytes);
+    for (size_t i = 1; i < length; ++i) {
+        u32 mask = (1u << (6 * i)) - 1;
+        if ((first & ~mask) == (last & ~mask))
+            continue;
+        if (first & mask) {
+            for_each_utf8_sequence(first, first | mask, callback);
+            for_each_utf8_sequence((first | mask) + 1, last, callback);
+            return;
+        }
+        if ((last & mask) != mask) {
+            for_each_utf8_sequence(first, (last & ~mask) - 1, callback);
+            for_each_utf8_sequence(last & ~mask, last, callback);
+            return;
+        }
+    }
+
+    encode_utf8(last, last_bytes);
+    callback(first_bytes, last_bytes, length);
+}
+
+static u32 parse_pattern(const String& pattern, Vector<RegexNode>& nodes)
+{
+    RegexParser parser(pattern, nodes);
+    return parser.parse();
+}
+
+RegexKernel RegexKernel::classify(const Vector<RegexNode>& nodes, u32 root)
+{
+    RegexKernel kernel;
+
+    Vector<u32> items;
+    if (nodes[root].type == RegexNodeType::Concatenation)
+        items = nodes[root].children;
+    else if (nodes[root].type != RegexNodeType::Empty)
+        items.append(root);
+
+    bool anchored_begin = !items.is_empty() && nodes[items.first()].type == RegexNodeType::AssertBegin;
+    if (anchored_begin)
+        items.remove(0);
+    bool anchored_end = !items.is_empty() && nodes[items.last()].type == RegexNodeType::AssertEnd;
+    if (anchored_end)
+        items.take_last();
+
+    StringBuilder literal;
+    bool is_literal = true;
+    for (auto item : items) {
+        auto& node = nodes[item];
+        if (node.type != RegexNodeType::Class || node.ranges.size() != 1 || node.ranges[0].first != node.ranges[0].last) {
+            is_literal = false;
+            break;
+        }
+        u8 bytes[4];
+        size_t length = encode_utf8(node.ranges[0].first, bytes);
+        for (size_t i = 0; i < length; ++i)
+            literal.append((char)bytes[i]);
+    }
+    if (is_literal) {
+        kernel.literal = literal.to_string();
+        if (anchored_begin && anchored_end)
+            kernel.type = Type::Exact;
+        else if (anchored_begin)
+            kernel.type = Type::Prefix;
+        else if (anchored_end)
+            kernel.type = Type::Suffix;
+        else
+            kernel.type = Type::Contains;
+        return kernel;
+    }
+
+    if (!anchored_begin || !anchored_end || items.size() != 1)
+        return kernel;
+
+    u32 run = items[0];
+    kernel.run_min = 1;
+    kernel.run_max = 1;
+    if (nodes[run].type == RegexNodeType::Repetition) {
+        kernel.run_min = nodes[run].min;
+        kernel.run_max = nodes[run].max;
+        run = nodes[run].children[0];
+    }
+    if (nodes[run].type != RegexNodeType::Class)
+        return kernel;
+    for (auto& range : nodes[run].ranges) {
+        if (range.last >= 0x80)
+            return kernel;
+    }
+
+    // ASCII classes match one byte per character, other bytes never match
+    memset(kernel.run_table, 0, sizeof(kernel.run_table));
+    for (auto& range : nodes[run].ranges) {
+        for (u32 c = range.first; c <= range.last; ++c)
+            kernel.run_table[c] = true;
+    }
+    kernel.type = Type::ClassRun;
+    return kernel;
+}
+
+bool RegexKernel::matches(const char* characters, size_t length) const
+{
+    switch (type) {
+    case Type::Exact:
+        return length == literal.length() && !memcmp(characters, literal.characters(), length);
+    case Type::Prefix:
+        return length >= literal.length() && !memcmp(characters, literal.characters(), literal.length());
+    case Type::Suffix:
+        return length >= literal.length() && !memcmp(characters + length - literal.length(), literal.characters(), literal.length());
+    case Type::Contains: {
+        size_t literal_length = literal.length();
+        if (!literal_length)
+            return true;
+        for (size_t i = 0; i + literal_length <= length; ++i) {
+            auto* candidate = (const char*)memchr(characters + i, literal[0], length - literal_length - i + 1);
+            if (!candidate)
+                return false;
+            i = candidate - characters;
+            if (!memcmp(candidate, literal.characters(), literal_length))
+                return true;
+        }
+        return false;
+    }
+    case Type::ClassRun:
+        if (length < run_min || (run_max != unbounded && length > run_max))
+            return false;
+        for (size_t i = 0; i < length; ++i) {
+            if (!run_table[(u8)characters[i]])
+                return false;
+        }
+        return true;
+    case Type::None:
+        break;
+    }
+    ASSERT_NOT_REACHED();
+}
+
+RegexAutomaton::RegexAutomaton()
+{
+    pthread_mutex_init(&m_dfa_lock, nullptr);
+}
+
+// Copies share nothing, the copy builds its own DFA.
+RegexAutomaton::RegexAutomaton(const RegexAutomaton& other)
+    : m_nfa(other.m_nfa)
+    , m_starts(other.m_starts)
+{
+    pthread_mutex_init(&m_dfa_lock, nullptr);
+    while (m_marks.size() < m_nfa.size())
+        m_marks.append(0);
+}
+
+RegexAutomaton& RegexAutomaton::operator=(const RegexAutomaton& other)
+{
+    if (this == &other)
+        return *this;
+    m_nfa = other.m_nfa;
+    m_starts = other.m_starts;
+    clear_dfa();
+    m_marks.clear();
+    while (m_marks.size() < m_nfa.size())
+        m_marks.append(0);
+    m_generation = 0;
+    return *this;
+}
+
+RegexAutomaton::~RegexAutomaton()
+{
+    clear_dfa();
+    pthread_mutex_destroy(&m_dfa_lock);
+}
+
+// Only while no other thread is matching.
+void RegexAutomaton::clear_dfa()
+{
+    for (u32 i = 0; i < m_dfa_size; ++i)
+        delete m_dfa[i];
+    m_dfa_size = 0;
+}
+
+bool RegexAutomaton::add(const Vector<RegexNode>& nodes, u32 root)
+{
+    size_t state_count = m_nfa.size();
+    u32 accept = add_state(NfaState::Kind::Accept, m_starts.size());
+    u32 start = compile(nodes, root, accept);
+    if (m_nfa.size() > max_nfa_states) {
+        m_nfa.shrink(state_count);
+        return false;
+    }
+
+    m_starts.append(start);
+    while (m_marks.size() < m_nfa.size())
+        m_marks.append(0);
+    clear_dfa();
+    return true;
+}
+
+u32 RegexAutomaton::add_state(NfaState::Kind kind, u32 next, u32 alternative, u8 low, u8 high)
+{
+    NfaState state;
+    state.kind = kind;
+    state.next = next;
+    state.alternative = alternative;
+    state.low = low;
+    state.high = high;
+    m_nfa.append(state);
+    return m_nfa.size() - 1;
+}
+
+// Builds the states of a node backwards, returns the entry state that continues with next.
+u32 RegexAutomaton::compile(const Vector<RegexNode>& nodes, u32 node, u32 next)
+{
+    if (m_nfa.size() > max_nfa_states)
+        return next;
+
+    auto& regex_node = nodes[node];
+    switch (regex_node.type) {
+    case RegexNodeType::Empty:
+        return next;
+
+    case RegexNodeType::AssertBegin:
+        return add_state(NfaState::Kind::AssertBegin, next);
+
+    case RegexNodeType::AssertEnd:
+        return add_state(NfaState::Kind::AssertEnd, next);
+
+    case RegexNodeType::Class: {
+        Vector<u32> entries;
+        for (auto& range : regex_node.ranges) {
+            for_each_utf8_sequence(range.first, range.last, [&](const u8* first_bytes, const u8* last_bytes, size_t length) {
+                u32 state = next;
+                for (size_t i = length; i-- > 0;)
+                    state = add_state(NfaState::Kind::Bytes, state, 0, first_bytes[i], last_bytes[i]);
+                entries.append(state);
+            });
+        }
+        // an empty class never matches
+        if (entries.is_empty())
+            return add_state(NfaState::Kind::Bytes, next, 0, 1, 0);
+        u32 entry = entries.last();
+        for (size_t i = entries.size() - 1; i-- > 0;)
+            entry = add_state(NfaState::Kind::Split, entries[i], entry);
+        return entry;
+    }
+
+    case RegexNodeType::Concatenation:
+        for (size_t i = regex_node.children.size(); i-- > 0;)
+            next = compile(nodes, regex_node.children[i], next);
+        return next;
+
+    case RegexNodeType::Alternation: {
+        u32 entry = compile(nodes, regex_node.children.last(), next);
+        for (size_t i = regex_node.children.size() - 1; i-- > 0;)
+            entry = add_state(NfaState::Kind::Split, compile(nodes, regex_node.children[i], next), entry);
+        return entry;
+    }
+
+    case RegexNodeType::Repetition: {
+        u32 child = regex_node.children[0];
+        u32 entry = next;
+        if (regex_node.max == unbounded) {
+            u32 loop = add_state(NfaState::Kind::Split, 0, next);
+            m_nfa[loop].next = compile(nodes, child, loop);
+            entry = loop;
+        } else {
+            for (u32 i = regex_node.min; i < regex_node.max; ++i)
+                entry = add_state(NfaState::Kind::Split, compile(nodes, child, entry), next);
+        }
+        for (u32 i = 0; i < regex_node.min; ++i)
+            entry = compile(nodes, child, entry);
+        return entry;
+    }
+    }
+    ASSERT_NOT_REACHED();
+}
+
+void RegexAutomaton::add_closure(Vector<u32>& set, u32 state, bool at_begin, bool at_end) const
+{
+    Vector<u32, 32> stack;
+    stack.append(state);
+    while (!stack.is_empty()) {
+        u32 current = stack.take_last();
+        if (m_marks[current] == m_generation)
+            continue;
+        m_marks[current] = m_generation;
+
+        auto& nfa_state = m_nfa[current];
+        switch (nfa_state.kind) {
+        case NfaState::Kind::Bytes:
+        case NfaState::Kind::Accept:
+            set.append(current);
+            break;
+        case NfaState::Kind::Split:
+            stack.append(nfa_state.alternative);
+            stack.append(nfa_state.next);
+            break;
+        case NfaState::Kind::AssertBegin:
+            if (at_begin)
+                stack.append(nfa_state.next);
+            break;
+        case NfaState::Kind::AssertEnd:
+            // kept in the set, to be followed at the end of the input
+            if (at_end)
+                stack.append(nfa_state.next);
+            else
+                set.append(current);
+            break;
+        }
+    }
+}
+
+// A search may start at every position of the input.
+void RegexAutomaton::add_start_closures(Vector<u32>& set, bool at_begin) const
+{
+    for (auto start : m_starts)
+        add_closure(set, start, at_begin, false);
+}
+
+static void add_match(RegexMatches& matches, u32 pattern)
+{
+    if (!matches.contains_slow(pattern))
+        matches.append(pattern);
+}
+
+const RegexAutomaton::DfaState& RegexAutomaton::dfa_state(u32 index, const Vector<DfaState>& private_states) const
+{
+    return index < max_dfa_states ? *m_dfa[index] : private_states[index - max_dfa_states];
+}
+
+RegexAutomaton::DfaState& RegexAutomaton::dfa_state(u32 index, Vector<DfaState>& private_states) const
+{
+    return index < max_dfa_states ? *m_dfa[index] : private_states[index - max_dfa_states];
+}
+
+// With the lock held.
+u32 RegexAutomaton::find_or_add_dfa_state(Vector<u32>& set, bool at_begin, Vector<DfaState>& private_states) const
+{
+    quick_sort(set.begin(), set.end(), [](u32 a, u32 b) { return a < b; });
+    u32 hash = at_begin;
+    for (auto state : set)
+        hash = pair_int_hash(hash, state);
+
+    auto is_same = [&](const DfaState& existing) {
+        if (existing.hash != hash || existing.at_begin != at_begin || existing.nfa_states.size() != set.size())
+            return false;
+        return !memcmp(existing.nfa_states.data(), set.data(), set.size() * sizeof(u32));
+    };
+    for (u32 i = 0; i < m_dfa_size; ++i) {
+        if (is_same(*m_dfa[i]))
+            return i;
+    }
+    for (u32 i = 0; i < private_states.size(); ++i) {
+        if (is_same(private_states[i]))
+            return max_dfa_states + i;
+    }
+
+    DfaState state;
+    state.hash = hash;
+    state.at_begin = at_begin;
+    Vector<u32> end_set;
+    ++m_generation;
+    for (auto nfa_state : set) {
+        switch (m_nfa[nfa_state].kind) {
+        case NfaState::Kind::Accept:
+            state.accepted.append(m_nfa[nfa_state].next);
+            break;
+        case NfaState::Kind::Bytes:
+            state.pending = true;
+            break;
+        case NfaState::Kind::AssertEnd:
+            state.pending = true;
+            add_closure(end_set, m_nfa[nfa_state].next, at_begin, true);
+            break;
+        default:
+            break;
+        }
+    }
+    state.accepted_at_end = state.accepted;
+    for (auto nfa_state : end_set) {
+        if (m_nfa[nfa_state].kind == NfaState::Kind::Accept)
+            add_match(state.accepted_at_end, m_nfa[nfa_state].next);
+    }
+    quick_sort(state.accepted.begin(), state.accepted.end(), [](u32 a, u32 b) { return a < b; });
+    quick_sort(state.accepted_at_end.begin(), state.accepted_at_end.end(), [](u32 a, u32 b) { return a < b; });
+    for (size_t i = 0; i < 256; ++i)
+        state.next[i] = unknown_dfa_state;
+    state.nfa_states = move(set);
+    if (m_dfa_size < max_dfa_states) {
+        m_dfa[m_dfa_size] = new DfaState(move(state));
+        __atomic_store_n(&m_dfa_size, m_dfa_size + 1, __ATOMIC_RELEASE);
+        return m_dfa_size - 1;
+    }
+    private_states.append(move(state));
+    return max_dfa_states + private_states.size() - 1;
+}
+
+u32 RegexAutomaton::transition(u32 from, u8 byte, Vector<DfaState>& private_states) const
+{
+    pthread_mutex_lock(&m_dfa_lock);
+    // another thread may have added the transition in the meantime
+    u32 to = __atomic_load_n(&dfa_state(from, private_states).next[byte], __ATOMIC_ACQUIRE);
+    if (to != unknown_dfa_state) {
+        pthread_mutex_unlock(&m_dfa_lock);
+        return to;
+    }
+
+    Vector<u32> set;
+    ++m_generation;
+    for (auto nfa_state : dfa_state(from, private_states).nfa_states) {
+        auto& state = m_nfa[nfa_state];
+        if (state.kind == NfaState::Kind::Bytes && byte >= state.low && byte <= state.high)
+            add_closure(set, state.next, false, false);
+        // a pattern that matched stays matched
+        if (state.kind == NfaState::Kind::Accept)
+            add_closure(set, nfa_state, false, false);
+    }
+    add_start_closures(set, false);
+
+    // the private states are a cache as well, they're dropped when they grow too big
+    bool dropped = false;
+    if (m_dfa_size == max_dfa_states && private_states.size() >= max_dfa_states) {
+        private_states.clear();
+        dropped = true;
+    }
+    to = find_or_add_dfa_state(set, false, private_states);
+    // the shared DFA must not lead to the states of one search
+    if (!dropped && (from >= max_dfa_states || to < max_dfa_states))
+        __atomic_store_n(&dfa_state(from, private_states).next[byte], to, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&m_dfa_lock);
+    return to;
+}
+
+void RegexAutomaton::search(const char* characters, size_t length, RegexMatches& matches, bool stop_at_first) const
+{
+    if (m_starts.is_empty())
+        return;
+
+    Vector<DfaState> private_states;
+    if (!__atomic_load_n(&m_dfa_size, __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&m_dfa_lock);
+        if (!m_dfa_size) {
+            Vector<u32> set;
+            ++m_generation;
+            add_start_closures(set, true);
+            find_or_add_dfa_state(set, true, private_states);
+        }
+        pthread_mutex_unlock(&m_dfa_lock);
+    }
+
+    u32 state = 0;
+    for (size_t i = 0; i < length; ++i) {
+        auto& dfa_state = this->dfa_state(state, private_states);
+        if ((stop_at_first && !dfa_state.accepted.is_empty()) || dfa_state.accepted.size() == m_starts.size() || !dfa_state.pending) {
+            for (auto pattern : dfa_state.accepted)
+                matches.append(pattern);
+            return;
+        }
+        u8 byte = characters[i];
+        u32 next = __atomic_load_n(&dfa_state.next[byte], __ATOMIC_ACQUIRE);
+        state = next != unknown_dfa_state ? next : transition(state, byte, private_states);
+    }
+    for (auto pattern : dfa_state(state, private_states).accepted_at_end)
+        matches.append(pattern);
+}
+
+Regex::Regex(const String& pattern)
+{
+    Vector<RegexNode> nodes;
+    u32 root = parse_pattern(pattern, nodes);
+    if (root == invalid_node)
+        return;
+
+    m_kernel = RegexKernel::classify(nodes, root);
+    m_supported = m_kernel.type != RegexKernel::Type::None || m_automaton.add(nodes, root);
+}
+
+bool Regex::search(const char* characters, size_t length) const
+{
+    if (!m_supported)
+        return false;
+    if (m_kernel.type != RegexKernel::Type::None)
+        return m_kernel.matches(characters, length);
+
+    RegexMatches matches;
+    m_automaton.search(characters, length, matches, true);
+    return !matches.is_empty();
+}
+
+RegexSet::RegexSet(const Vector<String>& patterns)
+    : m_patterns(patterns)
+{
+    for (u32 i = 0; i < patterns.size(); ++i) {
+        Vector<RegexNode> nodes;
+        u32 root = parse_pattern(patterns[i], nodes);
+        if (root == invalid_node)
+            continue;
+
+        auto kernel = RegexKernel::classify(nodes, root);
+        if (kernel.type != RegexKernel::Type::None) {
+            m_kernels.append(move(kernel));
+            m_kernel_patterns.append(i);
+        } else if (m_automaton.add(nodes, root)) {
+            m_automaton_patterns.append(i);
+        }
+    }
+}
+
+void RegexSet::search(const char* characters, size_t length, RegexMatches& matches) const
+{
+    matches.clear();
+    m_automaton.search(characters, length, matches, false);
+    for (auto& pattern : matches)
+        pattern = m_automaton_patterns[pattern];
+    for (size_t i = 0; i < m_kernels.size(); ++i) {
+        if (m_kernels[i].matches(characters, length))
+            matches.append(m_kernel_patterns[i]);
+    }
+    quick_sort(matches.begin(), matches.end(), [](u32 a, u32 b) { return a < b; });
+}
+
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <pthread.h>
+
+namespace JsonValidator {
+
+struct CodePointRange {
+    u32 first { 0 };
+    u32 last { 0 };
+};
+
+struct RegexNode;
+
+// Indices of matching patterns, in ascending order.
+using RegexMatches = Vector<u32, 8>;
+
+// Literals, anchored literals and anchored runs of one ASCII class, which are matched
+// with memcmp() or a lookup table instead of an automaton.
+struct RegexKernel {
+    enum class Type {
+        None,
+        Exact,
+        Prefix,
+        Suffix,
+        Contains,
+        ClassRun,
+    };
+
+    static RegexKernel classify(const Vector<RegexNode>&, u32 root);
+    bool matches(const char* characters, size_t length) const;
+
+    Type type { Type::None };
+    String literal;
+    bool run_table[256];
+    u32 run_min { 0 };
+    u32 run_max { 0 };
+};
+
+// The NFAs of one or more patterns over UTF-8 bytes, matched in one pass through a DFA
+// that is built lazily while matching, so matching time is linear in the input length.
+// The DFA is shared by all threads matching with the automaton. Its states never change
+// once added, and their transitions are published atomically, so matching only takes the
+// lock to add a state or transition. States that don't fit into a full DFA are private to
+// the search that needs them.
+class RegexAutomaton {
+public:
+    RegexAutomaton();
+    RegexAutomaton(const RegexAutomaton&);
+    RegexAutomaton& operator=(const RegexAutomaton&);
+    ~RegexAutomaton();
+
+    // Returns false if the automaton would grow too big.
+    bool add(const Vector<RegexNode>&, u32 root);
+    size_t pattern_count() const { return m_starts.size(); }
+
+    // Appends the patterns that match somewhere in the input. With stop_at_first, returns
+    // as soon as any pattern matches.
+    void search(const char* characters, size_t length, RegexMatches&, bool stop_at_first) const;
+
+private:
+    struct NfaState {
+        enum class Kind : u8 {
+            // consumes a byte in [low, high]
+            Bytes,
+            // epsilon transitions to next and alternative
+            Split,
+            AssertBegin,
+            AssertEnd,
+            // of the pattern in next
+            Accept,
+        };
+        Kind kind { Kind::Split };
+        u8 low { 0 };
+        u8 high { 0 };
+        u32 next { 0 };
+        u32 alternative { 0 };
+    };
+
+    static constexpr u32 max_dfa_states = 256;
+
+    struct DfaState {
+        // sorted NFA states, without the epsilon transitions
+        Vector<u32> nfa_states;
+        u32 hash { 0 };
+        bool at_begin { false };
+        // false if no more patterns can match, whatever input follows
+        bool pending { false };
+        // patterns matched so far, and at the end of the input
+        RegexMatches accepted;
+        RegexMatches accepted_at_end;
+        // read and written atomically, for states of the shared DFA
+        u32 next[256];
+    };
+
+    u32 compile(const Vector<RegexNode>&, u32 node, u32 next);
+    u32 add_state(NfaState::Kind, u32 next, u32 alternative = 0, u8 low = 0, u8 high = 0);
+
+    void add_closure(Vector<u32>& set, u32 state, bool at_begin, bool at_end) const;
+    void add_start_closures(Vector<u32>& set, bool at_begin) const;
+    // States from max_dfa_states on are in the private states of a search.
+    const DfaState& dfa_state(u32 index, const Vector<DfaState>& private_states) const;
+    DfaState& dfa_state(u32 index, Vector<DfaState>& private_states) const;
+    u32 find_or_add_dfa_state(Vector<u32>& set, bool at_begin, Vector<DfaState>& private_states) const;
+    u32 transition(u32 from, u8 byte, Vector<DfaState>& private_states) const;
+    void clear_dfa();
+
+    Vector<NfaState> m_nfa;
+    Vector<u32> m_starts;
+
+    // guards adding to the DFA, and the marks used to build its states
+    mutable pthread_mutex_t m_dfa_lock;
+    mutable DfaState* m_dfa[max_dfa_states] {};
+    mutable u32 m_dfa_size { 0 };
+    mutable Vector<u32> m_marks;
+    mutable u32 m_generation { 0 };
+};
+
+// A regular expression in the ECMA-262 syntax used by JSON Schema. Backreferences,
+// lookaround and word boundaries are not supported, as a DFA can't match them.
+class Regex {
+public:
+    explicit Regex(const String& pattern);
+
+    // False for syntax errors and for syntax that isn't supported.
+    bool is_supported() const { return m_supported; }
+
+    // Returns true if the pattern matches anywhere in the input, like RegExp.test().
+    bool search(const char* characters, size_t length) const;
+
+private:
+    bool m_supported { false };
+    RegexKernel m_kernel;
+    RegexAutomaton m_automaton;
+};
+
+// The patterns of patternProperties, matched against a key together. Patterns with a
+// kernel are checked on their own, all others share one automaton.
+class RegexSet {
+public:
+    explicit RegexSet(const Vector<String>& patterns);
+
+    const Vector<String>& patterns() const { return m_patterns; }
+
+    // Sets matches to the patterns that match somewhere in the input. Unsupported
+    // patterns never match.
+    void search(const char* characters, size_t length, RegexMatches& matches) const;
+
+private:
+    Vector<String> m_patterns;
+    Vector<RegexKernel> m_kernels;
+    Vector<u32> m_kernel_patterns;
+    RegexAutomaton m_automaton;
+    Vector<u32> m_automaton_patterns;
+};
+
+}
@@ -0,0 +1,632 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/JsonValue.h>
+#include <AK/StringView.h>
+#include <LibJsonValidator/Keywords.h>
+#include <LibJsonValidator/StreamingValidator.h>
+
+namespace JsonValidator {
+
+// Appends the token to the serialization of a buffered container, numbers as they were written.
+static void serialize_token(StringBuilder& builder, const Token& token, bool comma)
+{
+    if (comma)
+        builder.append(',');
+
+    switch (token.type) {
+    case TokenType::BeginObject:
+        builder.append('{');
+        break;
+    case TokenType::EndObject:
+        builder.append('}');
+        break;
+    case TokenType::BeginArray:
+        builder.append('[');
+        break;
+    case TokenType::EndArray:
+        builder.append(']');
+        break;
+    case TokenType::Key:
+        append_json_string(builder, token.value.as_string());
+        builder.append(':');
+        break;
+    case TokenType::Value:
+        if (token.value.is_string())
+            append_json_string(builder, token.value.as_string());
+        else if (token.value.is_number())
+            builder.append(token.number);
+        else
+            builder.append(token.value.to_string());
+        break;
+    }
+}
+
+// Appends the token to an excerpt, like excerpt() serializes a value.
+static void append_token(ExcerptBuilder& excerpt, const Token& token, bool comma)
+{
+    if (token.value.is_string()) {
+        if (comma)
+            excerpt.builder().append(',');
+        excerpt.append_string(token.value.as_string());
+        if (token.type == TokenType::Key)
+            excerpt.builder().append(':');
+        return;
+    }
+
+    if (token.type == TokenType::Value) {
+        if (comma)
+            excerpt.builder().append(',');
+        excerpt.builder().append(token.value.to_string());
+        return;
+    }
+
+    serialize_token(excerpt.builder(), token, comma);
+}
+
+StreamingValidator::StreamingValidator(const Program& program, ValidationError* e)
+    : m_program(program)
+    , m_interpreter(program)
+    , m_e(e)
+    , m_valid(!program.is_empty())
+{
+    if (!program.is_empty())
+        m_document_targets.append({ 0, e, invalid_index, Report::Valid });
+}
+
+StreamingValidator::~StreamingValidator()
+{
+}
+
+void StreamingValidator::append(const char* characters, size_t length)
+{
+    m_tokenizer.append(characters, length);
+    process_tokens();
+}
+
+bool StreamingValidator::finish()
+{
+    m_tokenizer.finish();
+    process_tokens();
+
+    if (!m_tokenizer.is_done()) {
+        if (m_e)
+            m_e->addf("Invalid JSON: %s", m_tokenizer.error().characters());
+        return false;
+    }
+    return m_valid;
+}
+
+void StreamingValidator::process_tokens()
+{
+    Token token;
+    while (m_tokenizer.next(token)) {
+        // without errors to collect, the first failure decides
+        if (m_valid || m_e)
+            process(token);
+    }
+}
+
+void StreamingValidator::process(const Token& token)
+{
+    bool is_end = token.type == TokenType::EndObject || token.type == TokenType::EndArray;
+    bool comma = !m_after_separator && !is_end;
+    m_after_separator = token.type == TokenType::BeginObject || token.type == TokenType::BeginArray || token.type == TokenType::Key;
+
+    if (m_buffered_depth)
+        serialize_token(m_buffer, token, comma);
+
+    // An excerpt that is full is complete, and so are those of the containers around it.
+    auto append_to_excerpts = [&](bool with_comma) {
+        for (size_t i = m_depth; i > 0 && !m_frames[i - 1].excerpt.is_full(); --i)
+            append_token(m_frames[i - 1].excerpt, token, with_comma);
+    };
+
+    switch (token.type) {
+    case TokenType::BeginObject:
+    case TokenType::BeginArray:
+        append_to_excerpts(comma);
+        if (m_buffered_depth) {
+            ++m_buffered_depth;
+            return;
+        }
+        begin_container(token.type == TokenType::BeginObject);
+        return;
+
+    case TokenType::EndObject:
+    case TokenType::EndArray:
+        append_to_excerpts(false);
+        end_container();
+        return;
+
+    case TokenType::Key:
+        append_to_excerpts(comma);
+        if (!m_buffered_depth)
+            begin_member(token.value.as_string());
+        return;
+
+    case TokenType::Value:
+        append_to_excerpts(comma);
+        if (m_buffered_depth)
+            return;
+        if (m_depth && !m_frames[m_depth - 1].is_object)
+            prepare_item(m_frames[m_depth - 1]);
+        for (auto& target : m_depth ? m_frames[m_depth - 1].member_targets : m_document_targets)
+            report(target, execute(target, token.value, m_depth), m_depth);
+        end_value();
+        return;
+    }
+}
+
+void StreamingValidator::begin_container(bool is_object)
+{
+    if (m_depth && !m_frames[m_depth - 1].is_object)
+        prepare_item(m_frames[m_depth - 1]);
+    auto& targets = m_depth ? m_frames[m_depth - 1].member_targets : m_document_targets;
+
+    if (m_frames.size() == m_depth)
+        m_frames.append(make<Frame>());
+    auto& frame = m_frames[m_depth++];
+    frame.is_object = is_object;
+    frame.count = 0;
+    frame.key = {};
+    frame.targets = targets;
+    frame.activations.clear();
+    frame.member_targets.clear();
+    frame.has_dependent_schemas = false;
+    frame.symbols.clear();
+    frame.excerpt.clear();
+    frame.excerpt.builder().append(is_object ? '{' : '[');
+
+    for (u32 i = 0; i < frame.targets.size(); ++i) {
+        auto& target = frame.targets[i];
+        if (!plan(frame, target.subroutine, target.e, invalid_index, Link::Target, i)) {
+            frame.activations.clear();
+            m_buffer.clear();
+            m_buffer.append(is_object ? '{' : '[');
+            m_buffered_depth = 1;
+            return;
+        }
+    }
+}
+
+u32 StreamingValidator::add_activation(Frame& frame, u32 subroutine, ValidationError* e, u32 parent, Link link, u32 link_operand)
+{
+    u32 index = frame.activations.size();
+    frame.activations.append({});
+    auto& activation = frame.activations[index];
+    activation.subroutine = subroutine;
+    activation.parent = parent;
+    activation.link = link;
+    activation.link_operand = link_operand;
+    if (link == Link::DependentSchema && e) {
+        activation.dependent_errors = make<ValidationError>();
+        e = activation.dependent_errors.ptr();
+    }
+    activation.e = e;
+    return index;
+}
+
+bool StreamingValidator::plan(Frame& frame, u32 subroutine, ValidationError* e, u32 parent, Link link, u32 link_operand)
+{
+    u32 index = add_activation(frame, subroutine, e, parent, link, link_operand);
+    e = frame.activations[index].e;
+
+    // allOf is compiled into the code of the subroutine, which may so check the members or
+    // the items more than once. Every further check gets an activation of its own.
+    auto part = [&](u32 Activation::*check) -> Activation& {
+        if (frame.activations[index].*check == invalid_index)
+            return frame.activations[index];
+        return frame.activations[add_activation(frame, subroutine, e, index, Link::Call, 0)];
+    };
+
+    TypeMask type = frame.is_object ? TypeMaskObject : TypeMaskArray;
+    u32 pc = m_program.subroutine(subroutine).entry;
+    u32 branch_group = invalid_index;
+    for (;;) {
+        auto& insn = m_program.at(pc++);
+        // planning callees adds activations, which may move this one
+        auto& activation = frame.activations[index];
+
+        switch (insn.opcode) {
+        case OpCode::CheckType:
+            if (!(insn.a & type)) {
+                defer(activation, ValidationErrorKind::Type, 0, insn.a);
+                activation.valid = false;
+                pc = insn.b;
+            }
+            break;
+
+        case OpCode::CheckPresent:
+            break;
+
+        case OpCode::JumpIfNotType:
+            if (!(insn.a & type))
+                pc = insn.b;
+            break;
+
+        case OpCode::Fail:
+            defer(activation, ValidationErrorKind::FalseSchema);
+            activation.valid = false;
+            break;
+
+        case OpCode::Call:
+            if (!plan(frame, insn.a, e, index, Link::Call, 0))
+                return false;
+            break;
+
+        case OpCode::BeginBranches:
+            branch_group = activation.checks.size();
+            activation.checks.append({ OpCode::BeginBranches });
+            break;
+
+        case OpCode::CallBranch:
+            if (!plan(frame, insn.a, nullptr, index, Link::Branch, branch_group))
+                return false;
+            break;
+
+        case OpCode::TaggedBranches: {
+            // the tag may come last, so all branches run
+            auto& table = m_program.tagged_union_table(insn.a);
+            for (u32 i = 0; i < table.branches.count; ++i) {
+                if (!plan(frame, m_program.index(table.branches.first + i), nullptr, index, Link::Branch, branch_group))
+                    return false;
+            }
+            break;
+        }
+
+        case OpCode::JumpIfMatches:
+            // matches are only known at the end, the remaining branches run as well
+            break;
+
+        case OpCode::EndAnyOf:
+        case OpCode::EndOneOf:
+        case OpCode::EndNot:
+            activation.checks[branch_group].opcode = insn.opcode;
+            break;
+
+        case OpCode::MinProperties:
+        case OpCode::MaxProperties:
+        case OpCode::MinItems:
+        case OpCode::MaxItems:
+            activation.checks.append({ insn.opcode, insn.a });
+            break;
+
+        case OpCode::Format:
+            // containers are never checked
+            break;
+
+        case OpCode::DependentSchema:
+            frame.has_dependent_schemas = true;
+            if (!plan(frame, insn.b, e, index, Link::DependentSchema, insn.a))
+                return false;
+            break;
+
+        case OpCode::Properties: {
+            auto& properties = part(&Activation::properties);
+            properties.properties = insn.a;
+            for (u32 i = 0; i < presence_words(m_program.property_table(insn.a)); ++i)
+                properties.present.append(0);
+            break;
+        }
+
+        case OpCode::Items:
+            part(&Activation::items).items = insn.a;
+            break;
+
+        case OpCode::TupleItems:
+            part(&Activation::tuple).tuple = insn.a;
+            break;
+
+        case OpCode::Contains:
+            part(&Activation::contains).contains = insn.a;
+            break;
+
+        case OpCode::Return:
+            return true;
+
+        default:
+            // enum and uniqueItems, and keywords of scalars
+            return false;
+        }
+
+        if (!frame.activations[index].valid && !e)
+            return true;
+    }
+}
+
+void StreamingValidator::begin_member(const String& key)
+{
+    auto& frame = m_frames[m_depth - 1];
+    frame.key = key;
+    frame.member_targets.clear();
+
+    if (frame.has_dependent_schemas) {
+        u32 symbol = m_program.symbol(key);
+        if (symbol != invalid_index)
+            frame.symbols.append(symbol);
+    }
+
+    for (u32 i = 0; i < frame.activations.size(); ++i) {
+        auto& activation = frame.activations[i];
+        if (activation.properties == invalid_index || (!activation.valid && !activation.e))
+            continue;
+
+        auto& table = m_program.property_table(activation.properties);
+        auto classification = m_interpreter.classification_of_key(activation.properties, key);
+
+        u32 property = invalid_index;
+        if (classification.slot != invalid_index) {
+            activation.present[classification.slot / 32] |= 1u << (classification.slot % 32);
+            property = m_program.property_entry(table.properties.first + classification.slot).subroutine;
+        }
+
+        if (property != invalid_index) {
+            frame.member_targets.append({ property, activation.e, i, Report::Valid });
+        } else {
+            for (auto pattern : classification.patterns)
+                frame.member_targets.append({ m_program.pattern_property(table.pattern_properties.first + pattern).subroutine, activation.e, i, Report::Valid });
+
+            if (classification.additional) {
+                if (table.additional_properties != invalid_index) {
+                    frame.member_targets.append({ table.additional_properties, activation.e, i, Report::AdditionalProperty });
+                } else {
+                    defer(activation, ValidationErrorKind::UnexpectedProperty, 0, 0, key);
+                    activation.valid = false;
+                }
+            }
+        }
+
+        if (!classification.property_name_valid) {
+            // run again for the errors
+            if (activation.e)
+                execute({ table.property_names, activation.e }, JsonValue(key), m_depth);
+            defer(activation, ValidationErrorKind::PropertyNames);
+            activation.valid = false;
+        }
+    }
+}
+
+void StreamingValidator::prepare_item(Frame& frame)
+{
+    frame.member_targets.clear();
+    for (u32 i = 0; i < frame.activations.size(); ++i) {
+        auto& activation = frame.activations[i];
+        if (!activation.valid && !activation.e)
+            continue;
+
+        if (activation.items != invalid_index)
+            frame.member_targets.append({ activation.items, activation.e, i, Report::Valid });
+
+        if (activation.tuple != invalid_index) {
+            auto& table = m_program.tuple_table(activation.tuple);
+            if (frame.count < table.items.count)
+                frame.member_targets.append({ m_program.index(table.items.first + frame.count), activation.e, i, Report::Valid });
+            else if (table.additional_items != invalid_index)
+                frame.member_targets.append({ table.additional_items, activation.e, i, Report::Valid });
+        }
+
+        if (activation.contains != invalid_index && !activation.contains_matched)
+            frame.member_targets.append({ activation.contains, nullptr, i, Report::Contains });
+    }
+}
+
+void StreamingValidator::end_value()
+{
+    if (m_depth)
+        ++m_frames[m_depth - 1].count;
+}
+
+void StreamingValidator::end_container()
+{
+    auto& frame = m_frames[m_depth - 1];
+
+    if (m_buffered_depth) {
+        if (--m_buffered_depth)
+            return;
+        auto json = JsonValue::from_string(m_buffer.string_view());
+        m_buffer.clear();
+        for (auto& target : frame.targets)
+            report(target, execute(target, json, m_depth - 1), m_depth - 1);
+    } else {
+        // activations that were started by another one come after it, so they are finished first
+        for (size_t i = frame.activations.size(); i > 0; --i)
+            finish_activation(frame, frame.activations[i - 1]);
+    }
+
+    --m_depth;
+    end_value();
+}
+
+void StreamingValidator::finish_activation(Frame& frame, Activation& activation)
+{
+    if (activation.valid || activation.e) {
+        for (auto& check : activation.checks) {
+            switch (check.opcode) {
+            case OpCode::MinProperties:
+            case OpCode::MinItems:
+                if (frame.count < check.operand) {
+                    defer(activation, check.opcode == OpCode::MinItems ? ValidationErrorKind::MinItems : ValidationErrorKind::MinProperties, frame.count, check.operand);
+                    activation.valid = false;
+                }
+                break;
+            case OpCode::MaxProperties:
+            case OpCode::MaxItems:
+                if (frame.count > check.operand) {
+                    defer(activation, check.opcode == OpCode::MaxItems ? ValidationErrorKind::MaxItems : ValidationErrorKind::MaxProperties, frame.count, check.operand);
+                    activation.valid = false;
+                }
+                break;
+            case OpCode::EndAnyOf:
+                if (!check.matches) {
+                    defer(activation, ValidationErrorKind::AnyOf);
+                    activation.valid = false;
+                }
+                break;
+            case OpCode::EndOneOf:
+                if (check.matches != 1) {
+                    defer(activation, ValidationErrorKind::OneOf);
+                    activation.valid = false;
+                }
+                break;
+            case OpCode::EndNot:
+                if (check.matches) {
+                    defer(activation, ValidationErrorKind::Not);
+                    activation.valid = false;
+                }
+                break;
+            default:
+                ASSERT_NOT_REACHED();
+            }
+        }
+
+        if (activation.properties != invalid_index) {
+            auto& table = m_program.property_table(activation.properties);
+            // Defers an error for every property of the mask that isn't present.
+            auto check_presence = [&](const IndexRange& mask, ValidationErrorKind kind) {
+                for (u32 i = 0; i < mask.count; ++i) {
+                    u32 missing = m_program.index(mask.first + i) & ~activation.present[i];
+                    if (!missing)
+                        continue;
+                    activation.valid = false;
+                    for (; missing && activation.e; missing &= missing - 1) {
+                        u32 slot = i * 32 + __builtin_ctz(missing);
+                        defer(activation, kind, 0, 0, m_program.string(m_program.property_entry(table.properties.first + slot).name));
+                    }
+                }
+            };
+
+            check_presence(table.required, ValidationErrorKind::Required);
+            for (u32 i = 0; i < table.dependent_required.count; ++i) {
+                auto& dependent_table = m_program.dependent_required_table(table.dependent_required.first + i);
+                if (activation.present[dependent_table.property / 32] & (1u << (dependent_table.property % 32)))
+                    check_presence(dependent_table.dependencies, ValidationErrorKind::DependentRequired);
+            }
+        }
+
+        if (activation.contains != invalid_index && !activation.contains_matched) {
+            defer(activation, ValidationErrorKind::Contains);
+            activation.valid = false;
+        }
+    }
+
+    if (activation.e && !activation.errors.is_empty()) {
+        auto instance = frame.excerpt.build();
+        auto& location = m_program.location(activation.subroutine);
+        push_instance_location(activation.e, m_depth - 1);
+        for (auto& error : activation.errors)
+            activation.e->add_with_excerpt(error.kind, location, instance, error.actual, error.bound, error.detail);
+        pop_instance_location(activation.e, m_depth - 1);
+    }
+
+    if (activation.link == Link::Target) {
+        report(frame.targets[activation.link_operand], activation.valid, m_depth - 1);
+        return;
+    }
+
+    auto& parent = frame.activations[activation.parent];
+    switch (activation.link) {
+    case Link::Call:
+        parent.valid &= activation.valid;
+        break;
+    case Link::Branch:
+        if (activation.valid)
+            ++parent.checks[activation.link_operand].matches;
+        break;
+    case Link::DependentSchema:
+        if (!activation.valid && frame.symbols.contains_slow(activation.link_operand)) {
+            if (parent.e) {
+                parent.e->append(*activation.dependent_errors);
+                defer(parent, ValidationErrorKind::DependentSchema);
+            }
+            parent.valid = false;
+        }
+        break;
+    default:
+        ASSERT_NOT_REACHED();
+    }
+}
+
+bool StreamingValidator::execute(const Target& target, const JsonValue& json, size_t depth)
+{
+    push_instance_location(target.e, depth);
+    bool valid = m_interpreter.execute(target.subroutine, json, target.e);
+    pop_instance_location(target.e, depth);
+    return valid;
+}
+
+void StreamingValidator::report(const Target& target, bool valid, size_t depth)
+{
+    if (target.activation == invalid_index) {
+        m_valid &= valid;
+        return;
+    }
+
+    auto& activation = m_frames[depth - 1].activations[target.activation];
+    switch (target.report) {
+    case Report::Valid:
+        activation.valid &= valid;
+        break;
+    case Report::AdditionalProperty:
+        if (!valid) {
+            defer(activation, ValidationErrorKind::AdditionalProperty);
+            activation.valid = false;
+        }
+        break;
+    case Report::Contains:
+        activation.contains_matched |= valid;
+        break;
+    }
+}
+
+void StreamingValidator::defer(Activation& activation, ValidationErrorKind kind, double actual, double bound, const String& detail)
+{
+    if (activation.e)
+        activation.errors.append({ kind, actual, bound, detail });
+}
+
+void StreamingValidator::push_instance_location(ValidationError* e, size_t depth) const
+{
+    if (!e)
+        return;
+    for (size_t i = 0; i < depth; ++i) {
+        auto& frame = m_frames[i];
+        if (frame.is_object)
+            e->push_instance_key(frame.key);
+        else
+            e->push_instance_index(frame.count);
+    }
+}
+
+void StreamingValidator::pop_instance_location(ValidationError* e, size_t depth) const
+{
+    if (!e)
+        return;
+    for (size_t i = 0; i < depth; ++i)
+        e->pop_instance_segment();
+}
+
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtrVector.h>
+#include <AK/OwnPtr.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibJsonValidator/Bytecode.h>
+#include <LibJsonValidator/Interpreter.h>
+#include <LibJsonValidator/Tokenizer.h>
+#include <LibJsonValidator/Validator.h>
+
+namespace JsonValidator {
+
+// Validates a document while it is read, without building it as a JsonValue. The program
+// runs as a state machine over the tokens of the document: when an object or an array
+// begins, the code of every subroutine that applies to it is split into what the type of
+// the container already decides, what is passed on to its members and items, and what
+// is decided at its end (counts, required properties, and the branches of anyOf, oneOf
+// and not, which run side by side). Scalars are handed to the Interpreter as they arrive.
+//
+// uniqueItems and enum need a container as a whole. Such a container is buffered and
+// validated by the Interpreter once it is complete, so the memory a document takes is
+// bounded by its depth and by the containers that need buffering.
+//
+// The verdict is that of the Interpreter. Errors may come in another order, and the items
+// of an array that fails minItems or maxItems are still validated.
+class StreamingValidator {
+public:
+    // Errors are only collected if `e` is not null, validation then stops at the first failure.
+    StreamingValidator(const Program&, ValidationError* e);
+    ~StreamingValidator();
+
+    // Validates as much of the document as the chunk completes.
+    void append(const char* characters, size_t length);
+    // Ends the document. Returns whether it is valid JSON and valid against the schema.
+    bool finish();
+
+private:
+    // What the result of a member or an item means to the container.
+    enum class Report : u8 {
+        Valid,
+        AdditionalProperty,
+        Contains,
+    };
+
+    // A subroutine the next value is validated against, and the activation of the
+    // enclosing container it reports to, invalid_index for the document itself.
+    struct Target {
+        u32 subroutine { 0 };
+        ValidationError* e { nullptr };
+        u32 activation { invalid_index };
+        Report report { Report::Valid };
+    };
+
+    // How an activation adds to the one that started it on the same container.
+    enum class Link : u8 {
+        // reports to the target of the container, operand is its index
+        Target,
+        Call,
+        // operand is the check of the branch group
+        Branch,
+        // operand is the symbol of the property the schema depends on
+        DependentSchema,
+    };
+
+    // A count or a branch group, decided at the end of the container.
+    struct Check {
+        OpCode opcode;
+        u32 operand { 0 };
+        u32 matches { 0 };
+    };
+
+    // An error about the container, added once its excerpt is complete.
+    struct DeferredError {
+        ValidationErrorKind kind;
+        double actual { 0 };
+        double bound { 0 };
+        String detail;
+    };
+
+    // A subroutine running on a container.
+    struct Activation {
+        u32 subroutine { 0 };
+        ValidationError* e { nullptr };
+        // the activation this one was started by, on the same container
+        u32 parent { invalid_index };
+        Link link { Link::Target };
+        u32 link_operand { 0 };
+        bool valid { true };
+
+        Vector<Check, 2> checks;
+        Vector<DeferredError> errors;
+        u32 properties { invalid_index };
+        Vector<u32, 4> present;
+        u32 items { invalid_index };
+        u32 tuple { invalid_index };
+        u32 contains { invalid_index };
+        bool contains_matched { false };
+        // the errors of a dependent schema, which only count if its property is present
+        OwnPtr<ValidationError> dependent_errors;
+    };
+
+    // An open container of the document. Frames are kept for reuse once they are closed.
+    struct Frame {
+        bool is_object { false };
+        // completed members or items
+        size_t count { 0 };
+        // of the current member
+        String key;
+        Vector<Target, 4> targets;
+        Vector<Activation, 4> activations;
+        // of the current member or item
+        Vector<Target, 4> member_targets;
+        // symbols of the present properties, only if there are dependent schemas
+        bool has_dependent_schemas { false };
+        Vector<u32, 8> symbols;
+        ExcerptBuilder excerpt;
+    };
+
+    void process_tokens();
+    void process(const Token&);
+
+    void begin_container(bool is_object);
+    void end_container();
+    void begin_member(const String& key);
+    void prepare_item(Frame&);
+    void end_value();
+
+    u32 add_activation(Frame&, u32 subroutine, ValidationError* e, u32 parent, Link, u32 link_operand);
+    // Splits the code of the subroutine for the container, returns false if it needs the container as a whole.
+    bool plan(Frame&, u32 subroutine, ValidationError* e, u32 parent, Link, u32 link_operand);
+    void finish_activation(Frame&, Activation&);
+
+    bool execute(const Target&, const JsonValue&, size_t depth);
+    void report(const Target&, bool valid, size_t depth);
+    void defer(Activation&, ValidationErrorKind, double actual = 0, double bound = 0, const String& detail = {});
+
+    // Puts the location of a value `depth` containers deep into `e`, and takes it out again.
+    void push_instance_location(ValidationError* e, size_t depth) const;
+    void pop_instance_location(ValidationError* e, size_t depth) const;
+
+    const Program& m_program;
+    Interpreter m_interpreter;
+    Tokenizer m_tokenizer;
+    ValidationError* m_e { nullptr };
+    bool m_valid { true };
+
+    Vector<Target, 4> m_document_targets;
+    NonnullOwnPtrVector<Frame> m_frames;
+    size_t m_depth { 0 };
+    // whether the previous token began a container or was a key, so no comma follows it
+    bool m_after_separator { true };
+
+    // The serialization of a container that is validated as a whole, and how deep into it the document is.
+    StringBuilder m_buffer;
+    size_t m_buffered_depth { 0 };
+};
+
+}
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/StdLibExtras.h>
+#include <AK/StringBuilder.h>
+#include <AK/StringView.h>
+#include <LibJsonValidator/Tokenizer.h>
+#include <ctype.h>
+#include <string.h>
+
+namespace JsonValidator {
+
+static bool is_whitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool is_number_character(char c)
+{
+    return isdigit((u8)c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+static bool is_valid_number(const char* characters, size_t length)
+{
+    size_t i = 0;
+    auto skip_digits = [&] {
+        size_t first = i;
+        while (i < length && isdigit((u8)characters[i]))
+            ++i;
+        return i > first;
+    };
+
+    if (i < length && characters[i] == '-')
+        ++i;
+    if (i < length && characters[i] == '0')
+        ++i;
+    else if (!skip_digits())
+        return false;
+    if (i < length && characters[i] == '.') {
+        ++i;
+        if (!skip_digits())
+            return false;
+    }
+    if (i < length && (characters[i] == 'e' || characters[i] == 'E')) {
+        ++i;
+        if (i < length && (characters[i] == '+' || characters[i] == '-'))
+            ++i;
+        if (!skip_digits())
+            return false;
+    }
+    return i == length;
+}
+
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+void Tokenizer::append(const char* characters, size_t length)
+{
+    ASSERT(!m_finished);
+
+    // drop what was consumed, so only an incomplete token is carried over
+    if (m_position) {
+        size_t remaining = available();
+        memmove(m_buffer.data(), m_buffer.data() + m_position, remaining);
+        m_buffer.shrink(remaining);
+        m_offset += m_position;
+        m_position = 0;
+    }
+    m_buffer.append(characters, length);
+}
+
+void Tokenizer::finish()
+{
+    m_finished = true;
+}
+
+bool Tokenizer::fail(const char* what)
+{
+    if (!has_error())
+        m_error = String::format("%s at offset %zu", what, m_offset + m_position);
+    return false;
+}
+
+void Tokenizer::end_value()
+{
+    m_expect = m_containers.is_empty() ? Expect::End : Expect::CommaOrEnd;
+}
+
+bool Tokenizer::scan_string(size_t& end)
+{
+    size_t i = m_position + 1 + m_scanned;
+    while (i < m_buffer.size()) {
+        char c = m_buffer[i];
+        if (c == '"') {
+            end = i;
+            return true;
+        }
+        if (c == '\\') {
+            // the escaped character may still be missing
+            if (i + 1 == m_buffer.size())
+                break;
+            i += 2;
+            continue;
+        }
+        ++i;
+    }
+    m_scanned = i - m_position - 1;
+    if (m_finished)
+        return fail("Unterminated string");
+    return false;
+}
+
+bool Tokenizer::unescape(size_t begin, size_t end, String& string)
+{
+    auto* characters = m_buffer.data();
+    if (!memchr(characters + begin, '\\', end - begin)) {
+        string = String(characters + begin, end - begin);
+        return true;
+    }
+
+    auto read_code_unit = [&](size_t at, u32& code_unit) {
+        if (at + 4 > end)
+            return false;
+        code_unit = 0;
+        for (size_t i = at; i < at + 4; ++i) {
+            int digit = hex_value(characters[i]);
+            if (digit < 0)
+                return false;
+            code_unit = code_unit * 16 + digit;
+        }
+        return true;
+    };
+
+    StringBuilder builder;
+    for (size_t i = begin; i < end; ++i) {
+        char c = characters[i];
+        if (c != '\\') {
+            builder.append(c);
+            continue;
+        }
+
+        char escaped = characters[++i];
+        switch (escaped) {
+        case '"':
+        case '\\':
+        case '/':
+            builder.append(escaped);
+            break;
+        case 'b':
+            builder.append('\b');
+            break;
+        case 'f':
+            builder.append('\f');
+            break;
+        case 'n':
+            builder.append('\n');
+            break;
+        case 'r':
+            builder.append('\r');
+            break;
+        case 't':
+            builder.append('\t');
+            break;
+        case 'u': {
+            u32 code_point;
+            if (!read_code_unit(i + 1, code_point))
+                return fail("Invalid unicode escape");
+            i += 4;
+            // a surrogate pair
+            u32 low;
+            if (code_point >= 0xd800 && code_point < 0xdc00 && i + 2 < end && characters[i + 1] == '\\' && characters[i + 2] == 'u'
+                && read_code_unit(i + 3, low) && low >= 0xdc00 && low < 0xe000) {
+                code_point = 0x10000 + ((code_point - 0xd800) << 10) + (low - 0xdc00);
+                i += 6;
+            }
+            builder.append_codepoint(code_point);
+            break;
+        }
+        default:
+            return fail("Invalid escape");
+        }
+    }
+    string = builder.to_string();
+    return true;
+}
+
+bool Tokenizer::scan_literal(const char* literal, Token& token)
+{
+    size_t length = strlen(literal);
+    size_t compared = min(length, available());
+    if (memcmp(m_buffer.data() + m_position, literal, compared))
+        return fail("Unexpected character");
+    if (compared < length) {
+        if (m_finished)
+            return fail("Unexpected end of document");
+        return false;
+    }
+
+    m_position += length;
+    token.type = TokenType::Value;
+    if (literal[0] == 'n')
+        token.value = JsonValue();
+    else
+        token.value = JsonValue(literal[0] == 't');
+    end_value();
+    return true;
+}
+
+bool Tokenizer::scan_number(Token& token)
+{
+    size_t length = 0;
+    while (length < available() && is_number_character(peek(length)))
+        ++length;
+    // the number may go on in the next chunk
+    if (length == available() && !m_finished)
+        return false;
+
+    auto* characters = m_buffer.data() + m_position;
+    if (!is_valid_number(characters, length))
+        return fail("Invalid number");
+
+    token.type = TokenType::Value;
+    token.number = String(characters, length);
+    // converted like the numbers of a parsed document, so both agree on their types
+    token.value = JsonValue::from_string(StringView(characters, length));
+    m_position += length;
+    end_value();
+    return true;
+}
+
+bool Tokenizer::next(Token& token)
+{
+    for (;;) {
+        if (has_error())
+            return false;
+
+        while (available() && is_whitespace(peek()))
+            ++m_position;
+        if (!available()) {
+            if (m_finished && m_expect != Expect::End)
+                fail("Unexpected end of document");
+            return false;
+        }
+        if (m_expect == Expect::End)
+            return fail("Unexpected content after the document");
+
+        char c = peek();
+        bool expects_value = m_expect == Expect::Value || m_expect == Expect::ValueOrEnd;
+        switch (c) {
+        case '{':
+        case '[':
+            if (!expects_value)
+                return fail("Unexpected character");
+            ++m_position;
+            m_containers.append(c);
+            m_expect = c == '{' ? Expect::KeyOrEnd : Expect::ValueOrEnd;
+            token.type = c == '{' ? TokenType::BeginObject : TokenType::BeginArray;
+            return true;
+
+        case '}':
+        case ']': {
+            bool is_object = c == '}';
+            bool may_end = m_expect == Expect::CommaOrEnd || m_expect == (is_object ? Expect::KeyOrEnd : Expect::ValueOrEnd);
+            if (!may_end || m_containers.last() != (is_object ? '{' : '['))
+                return fail("Unexpected character");
+            ++m_position;
+            m_containers.take_last();
+            end_value();
+            token.type = is_object ? TokenType::EndObject : TokenType::EndArray;
+            return true;
+        }
+
+        case ',':
+            if (m_expect != Expect::CommaOrEnd)
+                return fail("Unexpected character");
+            ++m_position;
+            m_expect = m_containers.last() == '{' ? Expect::Key : Expect::Value;
+            continue;
+
+        case ':':
+            if (m_expect != Expect::Colon)
+                return fail("Unexpected character");
+            ++m_position;
+            m_expect = Expect::Value;
+            continue;
+
+        case '"': {
+            bool is_key = m_expect == Expect::KeyOrEnd || m_expect == Expect::Key;
+            if (!is_key && !expects_value)
+                return fail("Unexpected character");
+            size_t end;
+            if (!scan_string(end))
+                return false;
+            String string;
+            if (!unescape(m_position + 1, end, string))
+                return false;
+            m_position = end + 1;
+            m_scanned = 0;
+            token.type = is_key ? TokenType::Key : TokenType::Value;
+            token.value = JsonValue(string);
+            if (is_key)
+                m_expect = Expect::Colon;
+            else
+                end_value();
+            return true;
+        }
+
+        case 't':
+        case 'f':
+        case 'n':
+            if (!expects_value)
+                return fail("Unexpected character");
+            return scan_literal(c == 't' ? "true" : c == 'f' ? "false" : "null", token);
+
+        default:
+            if (!expects_value || !(isdigit((u8)c) || c == '-'))
+                return fail("Unexpected character");
+            return scan_number(token);
+        }
+    }
+}
+
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <AK/JsonValue.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+
+namespace JsonValidator {
+
+enum class TokenType : u8 {
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    // the name of an object member, the value follows
+    Key,
+    // a string, number, boolean or null
+    Value,
+};
+
+struct Token {
+    TokenType type { TokenType::Value };
+    // the key or the scalar value
+    JsonValue value;
+    // numbers as they were written, so they can be serialized again without rounding
+    String number;
+};
+
+// Splits a JSON document that arrives in chunks into tokens. Only the part of the input
+// that doesn't form a complete token yet is kept, and the nesting of the containers is
+// checked as they are opened and closed, so the memory a document takes is bounded by
+// its largest token and its depth.
+class Tokenizer {
+public:
+    // Appends the next chunk of the document.
+    void append(const char* characters, size_t length);
+    // There is no more input, a number at the end of the document is complete now.
+    void finish();
+
+    // Takes the next complete token. Returns false if more input is needed, at the end
+    // of the document, or on a syntax error.
+    bool next(Token&);
+
+    bool has_error() const { return !m_error.is_null(); }
+    const String& error() const { return m_error; }
+    // The document was read to its end without error.
+    bool is_done() const { return m_expect == Expect::End && m_finished && !has_error(); }
+
+private:
+    enum class Expect : u8 {
+        Value,
+        // after '['
+        ValueOrEnd,
+        // after '{'
+        KeyOrEnd,
+        // after ',' in an object
+        Key,
+        Colon,
+        CommaOrEnd,
+        // after the value of the document
+        End,
+    };
+
+    bool fail(const char* what);
+    void end_value();
+    // Scans the token at the current position, returns false if it isn't complete yet.
+    bool scan_string(size_t& end);
+    bool scan_literal(const char* literal, Token&);
+    bool scan_number(Token&);
+    bool unescape(size_t begin, size_t end, String&);
+
+    char peek(size_t offset = 0) const { return m_buffer[m_position + offset]; }
+    size_t available() const { return m_buffer.size() - m_position; }
+
+    Vector<char> m_buffer;
+    size_t m_position { 0 };
+    // how far a string token was searched for its end, so a long string isn't searched again for every chunk
+    size_t m_scanned { 0 };
+    // of m_buffer in the document, for error messages
+    size_t m_offset { 0 };
+    // '{' or '[' for every open container
+    Vector<char, 32> m_containers;
+    Expect m_expect { Expect::Value };
+    bool m_finished { false };
+    String m_error;
+};
+
+}
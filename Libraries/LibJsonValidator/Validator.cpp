@@ -24,51 +24,324 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <AK/ByteBuffer.h>
+#include <AK/StringView.h>
 #include <LibCore/File.h>
+#include <LibJsonValidator/Format.h>
+#include <LibJsonValidator/Interpreter.h>
 #include <LibJsonValidator/JsonSchemaNode.h>
+#include <LibJsonValidator/Keywords.h>
 #include <LibJsonValidator/Parser.h>
+#include <LibJsonValidator/StreamingValidator.h>
 #include <LibJsonValidator/Validator.h>
 
 namespace JsonValidator {
 
-ValidationResult Validator::run(const Parser& parser, const String& filename)
+const char* to_string(ValidationErrorKind kind)
 {
-    ValidationError e;
-    auto schema_file = Core::File::construct(filename);
-    if (!schema_file->open(Core::IODevice::ReadOnly)) {
-        e.addf("Couldn't open %s for reading: %s\n", filename.characters(), schema_file->error_string());
-        return { e, false };
+    switch (kind) {
+#define __ENUMERATE_ERROR_KIND(name)   \
+    case ValidationErrorKind::name: \
+        return #name;
+        ENUMERATE_VALIDATION_ERROR_KINDS
+#undef __ENUMERATE_ERROR_KIND
     }
-    JsonValue json = JsonValue::from_string(schema_file->read_all());
+    ASSERT_NOT_REACHED();
+}
 
-    return run(parser, json);
+void append_json_string(StringBuilder& builder, const String& string)
+{
+    builder.append('"');
+    for (size_t i = 0; i < string.length(); ++i) {
+        char c = string[i];
+        if (c == '"' || c == '\\') {
+            builder.append('\\');
+            builder.append(c);
+        } else if ((u8)c < 0x20) {
+            builder.appendf("\\u%04x", c);
+        } else {
+            builder.append(c);
+        }
+    }
+    builder.append('"');
 }
 
-ValidationResult Validator::run(const Parser& parser, const FILE* fd)
+static void append_excerpt(ExcerptBuilder& excerpt, const JsonValue& value)
+{
+    if (excerpt.is_full())
+        return;
+
+    auto& builder = excerpt.builder();
+    if (value.is_string()) {
+        excerpt.append_string(value.as_string());
+        return;
+    }
+
+    if (value.is_array()) {
+        builder.append('[');
+        auto& values = value.as_array().values();
+        for (size_t i = 0; i < values.size() && !excerpt.is_full(); ++i) {
+            if (i)
+                builder.append(',');
+            append_excerpt(excerpt, values[i]);
+        }
+        builder.append(']');
+        return;
+    }
+
+    if (value.is_object()) {
+        builder.append('{');
+        bool first = true;
+        value.as_object().for_each_member([&](auto& key, auto& member) {
+            if (excerpt.is_full())
+                return;
+            if (!first)
+                builder.append(',');
+            first = false;
+            excerpt.append_string(key);
+            builder.append(':');
+            append_excerpt(excerpt, member);
+        });
+        builder.append('}');
+        return;
+    }
+
+    builder.append(value.to_string());
+}
+
+void ExcerptBuilder::append_string(const String& string)
+{
+    // Every byte takes at least one byte of the literal, so a prefix longer than the
+    // excerpt fills it all the same.
+    if (string.length() > m_max_length)
+        append_json_string(m_builder, string.substring(0, m_max_length + 1));
+    else
+        append_json_string(m_builder, string);
+}
+
+String ExcerptBuilder::build() const
+{
+    if (!is_full())
+        return m_builder.build();
+
+    // don't cut a UTF-8 sequence in half
+    auto serialized = m_builder.string_view();
+    size_t length = m_max_length;
+    while (length && ((u8)serialized.characters_without_null_termination()[length] & 0xc0) == 0x80)
+        --length;
+    return String::format("%s...", serialized.substring_view(0, length).to_string().characters());
+}
+
+String excerpt(const JsonValue& value, size_t max_length)
+{
+    // Only what fits is serialized, a large instance isn't walked further.
+    ExcerptBuilder excerpt(max_length);
+    append_excerpt(excerpt, value);
+    return excerpt.build();
+}
+
+String ValidationError::instance_location() const
 {
     StringBuilder builder;
-    for (;;) {
-        char buffer[1024];
-        if (!fgets(buffer, sizeof(buffer), const_cast<FILE*>(fd)))
-            break;
-        builder.append(buffer);
+    for (auto& segment : m_instance_path) {
+        builder.append('/');
+        if (segment.key)
+            builder.append(escape_json_pointer_segment(*segment.key));
+        else
+            builder.appendf("%zu", segment.index);
+    }
+    return builder.build();
+}
+
+String ValidationErrorRecord::to_string() const
+{
+    auto message = format_message();
+    if (instance_location.is_empty())
+        return message;
+    return String::format("%s: %s", instance_location.characters(), message.characters());
+}
+
+String ValidationErrorRecord::format_message() const
+{
+    const char* at = location.characters();
+    const char* have = instance.characters();
+
+    switch (kind) {
+    case ValidationErrorKind::Message:
+        return detail;
+    case ValidationErrorKind::Type:
+        return String::format("type validation failed: have '%s', but looking for node with type '%s'", have, type_mask_to_string((TypeMask)bound).characters());
+    case ValidationErrorKind::NotPresent:
+        return String::format("item is required, but is not present at %s, %s", at, have);
+    case ValidationErrorKind::FalseSchema:
+        return String::format("false schema never matches at %s, %s", at, have);
+    case ValidationErrorKind::AnyOf:
+        return String::format("not item matched in anyOf at %s, %s", at, have);
+    case ValidationErrorKind::OneOf:
+        return String::format("not one item matched in oneOf at %s, %s", at, have);
+    case ValidationErrorKind::Not:
+        return String::format("not matched at %s, %s", at, have);
+    case ValidationErrorKind::Enum:
+        return String::format("No enum matched at %s, %s", at, have);
+    case ValidationErrorKind::InstanceDefs:
+        return String::format("Subschema in $defs not valid at %s, %s", at, have);
+    case ValidationErrorKind::Pattern:
+        return String::format("String pattern not matching %s, %s", at, have);
+    case ValidationErrorKind::MaxLength:
+        return String::format("maxLength violation at %s, %s", at, have);
+    case ValidationErrorKind::MinLength:
+        return String::format("minLength violation at %s, %s", at, have);
+    case ValidationErrorKind::Format:
+        return String::format("String not a valid %s at %s, %s", JsonValidator::to_string((Format)bound), at, have);
+    case ValidationErrorKind::Minimum:
+        return String::format("Minimum invalid: value is %f, allowed is: %f at %s, %s", actual, bound, at, have);
+    case ValidationErrorKind::Maximum:
+        return String::format("Maximum invalid: value is %f, allowed is: %f at %s, %s", actual, bound, at, have);
+    case ValidationErrorKind::ExclusiveMinimum:
+        return String::format("exclusiveMinimum invalid: value is %f, allowed is: %f at %s, %s", actual, bound, at, have);
+    case ValidationErrorKind::ExclusiveMaximum:
+        return String::format("exclusiveMaximum invalid: value is %f, allowed is: %f at %s, %s", actual, bound, at, have);
+    case ValidationErrorKind::MultipleOf:
+        return String::format("multipleOf invalid: value is %f, allowed is multipleOf: %f at %s, %s", actual, bound, at, have);
+    case ValidationErrorKind::MinProperties:
+        return String::format("minProperties value of %.0f not met with %.0f items at %s, %s", bound, actual, at, have);
+    case ValidationErrorKind::MaxProperties:
+        return String::format("maxProperties value of %.0f not met with %.0f items at %s, %s", bound, actual, at, have);
+    case ValidationErrorKind::DependentSchema:
+        return String::format("dependentSchema not valid at %s, %s", at, have);
+    case ValidationErrorKind::AdditionalProperty:
+        return String::format("additionalProperty not valid at %s, %s", at, have);
+    case ValidationErrorKind::UnexpectedProperty:
+        return String::format("property %s not in schema definition at %s, %s", detail.characters(), at, have);
+    case ValidationErrorKind::PropertyNames:
+        return String::format("propertyNames not valid at %s, %s", at, have);
+    case ValidationErrorKind::Required:
+        return String::format("required value %s not found at %s, %s", detail.characters(), at, have);
+    case ValidationErrorKind::DependentRequired:
+        return String::format("dependentRequired dependency %s not found at %s, %s", detail.characters(), at, have);
+    case ValidationErrorKind::MinItems:
+        return String::format("minItems value of %.0f not met with %.0f items at %s, %s", bound, actual, at, have);
+    case ValidationErrorKind::MaxItems:
+        return String::format("maxItems value of %.0f not met with %.0f items at %s, %s", bound, actual, at, have);
+    case ValidationErrorKind::UniqueItems:
+        return String::format("uniqueItems violation with duplicate item %s at %s, %s", detail.characters(), at, have);
+    case ValidationErrorKind::Contains:
+        return String::format("Array contains violation at %s, %s", at, have);
     }
+    ASSERT_NOT_REACHED();
+}
 
-    JsonValue json = JsonValue::from_string(builder.to_string());
+Vector<String> ValidationError::errors() const
+{
+    Vector<String> errors;
+    for (auto& record : m_records)
+        errors.append(record.to_string());
+    return errors;
+}
 
-    return run(parser, json);
+bool validate_embedded_defs(const JsonValue& json, ValidationError* e)
+{
+    bool valid = true;
+    if (json.is_object()) {
+        auto& object = json.as_object();
+        if (object.has("$defs") && !instance_defs_valid(object)) {
+            if (!e)
+                return false;
+            e->add(ValidationErrorKind::InstanceDefs, "#", json);
+            valid = false;
+        }
+        object.for_each_member([&](auto& key, auto& value) {
+            if (!valid && !e)
+                return;
+            InstanceLocationScope scope(e, key);
+            valid &= validate_embedded_defs(value, e);
+        });
+    } else if (json.is_array()) {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size() && (valid || e); ++i) {
+            InstanceLocationScope scope(e, i);
+            valid &= validate_embedded_defs(values[i], e);
+        }
+    }
+    return valid;
+}
+
+// Documents are read in chunks of this size.
+static constexpr size_t chunk_size = 64 * 1024;
+
+template<typename ReadChunk>
+ValidationResult Validator::run_on_chunks(const Parser& parser, ReadChunk read_chunk)
+{
+    // Both need the document as a JsonValue.
+    if (m_validate_embedded_defs || m_profile) {
+        StringBuilder builder;
+        for (auto chunk = read_chunk(); !chunk.is_empty(); chunk = read_chunk())
+            builder.append(chunk);
+        return run(parser, JsonValue::from_string(builder.to_string()));
+    }
+
+    ValidationError e;
+    if (!parser.program())
+        return { e, false };
+    StreamingValidator validator(*parser.program(), &e);
+    for (auto chunk = read_chunk(); !chunk.is_empty(); chunk = read_chunk())
+        validator.append(chunk.characters_without_null_termination(), chunk.length());
+    bool valid = validator.finish();
+    return { e, valid };
+}
+
+ValidationResult Validator::run(const Parser& parser, const String& filename)
+{
+    auto file = Core::File::construct(filename);
+    if (!file->open(Core::IODevice::ReadOnly)) {
+        ValidationError e;
+        e.addf("Couldn't open %s for reading: %s\n", filename.characters(), file->error_string());
+        return { e, false };
+    }
+    return run(parser, *file);
+}
+
+ValidationResult Validator::run(const Parser& parser, Core::File& file)
+{
+    ByteBuffer buffer;
+    return run_on_chunks(parser, [&] {
+        buffer = file.read(chunk_size);
+        return StringView((const char*)buffer.data(), buffer.size());
+    });
+}
+
+ValidationResult Validator::run(const Parser& parser, const FILE* fd)
+{
+    char buffer[chunk_size];
+    return run_on_chunks(parser, [&] {
+        size_t length = fread(buffer, 1, sizeof(buffer), const_cast<FILE*>(fd));
+        return StringView(buffer, length);
+    });
 }
 
 ValidationResult Validator::run(const Parser& parser, const JsonValue& json)
 {
-#ifdef JSON_SCHEMA_DEBUG
-    printf("Run Validator on node: %lu\n", reinterpret_cast<intptr_t>(&node));
-#endif
     ValidationError e;
     bool valid { false };
-    if (parser.root_node())
-        valid = parser.root_node()->validate(json, e);
+    if (parser.program()) {
+        Interpreter interpreter(*parser.program());
+        interpreter.set_profile(m_profile);
+        valid = interpreter.run(json, e);
+        if (m_validate_embedded_defs)
+            valid &= validate_embedded_defs(json, &e);
+    }
     return { e, valid };
 }
 
+bool Validator::is_valid(const Parser& parser, const JsonValue& json)
+{
+    if (!parser.program())
+        return false;
+    Interpreter interpreter(*parser.program());
+    interpreter.set_profile(m_profile);
+    if (!interpreter.run(json))
+        return false;
+    return !m_validate_embedded_defs || validate_embedded_defs(json, nullptr);
+}
+
 }
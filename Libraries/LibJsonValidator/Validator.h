@@ -27,11 +27,111 @@
 #pragma once
 
 #include <AK/JsonValue.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
 #include <LibJsonValidator/Forward.h>
 #include <stdio.h>
 
+namespace Core {
+class File;
+}
+
 namespace JsonValidator {
 
+#define ENUMERATE_VALIDATION_ERROR_KINDS       \
+    __ENUMERATE_ERROR_KIND(Message)            \
+    __ENUMERATE_ERROR_KIND(Type)               \
+    __ENUMERATE_ERROR_KIND(NotPresent)         \
+    __ENUMERATE_ERROR_KIND(FalseSchema)        \
+    __ENUMERATE_ERROR_KIND(AnyOf)              \
+    __ENUMERATE_ERROR_KIND(OneOf)              \
+    __ENUMERATE_ERROR_KIND(Not)                \
+    __ENUMERATE_ERROR_KIND(Enum)               \
+    __ENUMERATE_ERROR_KIND(InstanceDefs)       \
+    __ENUMERATE_ERROR_KIND(Pattern)            \
+    __ENUMERATE_ERROR_KIND(MaxLength)          \
+    __ENUMERATE_ERROR_KIND(MinLength)          \
+    __ENUMERATE_ERROR_KIND(Format)             \
+    __ENUMERATE_ERROR_KIND(Minimum)            \
+    __ENUMERATE_ERROR_KIND(Maximum)            \
+    __ENUMERATE_ERROR_KIND(ExclusiveMinimum)   \
+    __ENUMERATE_ERROR_KIND(ExclusiveMaximum)   \
+    __ENUMERATE_ERROR_KIND(MultipleOf)         \
+    __ENUMERATE_ERROR_KIND(MinProperties)      \
+    __ENUMERATE_ERROR_KIND(MaxProperties)      \
+    __ENUMERATE_ERROR_KIND(DependentSchema)    \
+    __ENUMERATE_ERROR_KIND(AdditionalProperty) \
+    __ENUMERATE_ERROR_KIND(UnexpectedProperty) \
+    __ENUMERATE_ERROR_KIND(PropertyNames)      \
+    __ENUMERATE_ERROR_KIND(Required)           \
+    __ENUMERATE_ERROR_KIND(DependentRequired)  \
+    __ENUMERATE_ERROR_KIND(MinItems)           \
+    __ENUMERATE_ERROR_KIND(MaxItems)           \
+    __ENUMERATE_ERROR_KIND(UniqueItems)        \
+    __ENUMERATE_ERROR_KIND(Contains)
+
+// The keyword that failed, Message for errors that aren't about the instance.
+enum class ValidationErrorKind : u8 {
+#define __ENUMERATE_ERROR_KIND(name) name,
+    ENUMERATE_VALIDATION_ERROR_KINDS
+#undef __ENUMERATE_ERROR_KIND
+};
+
+const char* to_string(ValidationErrorKind);
+
+// A failure as it was found. The message is only formatted by to_string(), so
+// a rejected instance costs little more than an accepted one.
+struct ValidationErrorRecord {
+    ValidationErrorKind kind { ValidationErrorKind::Message };
+    // the schema location
+    String location;
+    // JSON pointer to the instance, empty for the root
+    String instance_location;
+    // the beginning of the serialized instance, see excerpt()
+    String instance;
+    // keyword specific: the value and the bound of the instance, a property name, ...
+    double actual { 0 };
+    double bound { 0 };
+    String detail;
+
+    // The message, preceded by the instance location unless that is the root.
+    String to_string() const;
+    // Only the message.
+    String format_message() const;
+};
+
+// Serializes at most about `max_length` bytes of the value, ending with "..." if it is cut off.
+String excerpt(const JsonValue&, size_t max_length = 80);
+
+// Appends the string as a JSON string literal.
+void append_json_string(StringBuilder&, const String&);
+
+// Collects the beginning of a serialized value, see excerpt(). Values that are only
+// seen piece by piece, like those of a stream, are serialized into builder() until
+// the excerpt is full.
+class ExcerptBuilder {
+public:
+    explicit ExcerptBuilder(size_t max_length = 80)
+        : m_max_length(max_length)
+    {
+    }
+
+    // Once it is full, the excerpt doesn't change anymore.
+    bool is_full() const { return m_builder.length() > m_max_length; }
+    StringBuilder& builder() { return m_builder; }
+    void clear() { m_builder.clear(); }
+
+    // Appends the string literal, or as much of it as the excerpt can take.
+    void append_string(const String&);
+
+    String build() const;
+
+private:
+    StringBuilder m_builder;
+    size_t m_max_length;
+};
+
 class ValidationError {
 public:
     ValidationError() = default;
@@ -39,7 +139,9 @@ public:
 
     void add(const String& error)
     {
-        m_errors.append(error);
+        ValidationErrorRecord record;
+        record.detail = error;
+        m_records.append(move(record));
     }
 
     template<class... Args>
@@ -50,21 +152,85 @@ public:
         add(b.build());
     }
 
+    void add(ValidationErrorKind kind, const String& location, const JsonValue& instance, double actual = 0, double bound = 0)
+    {
+        m_records.append({ kind, location, instance_location(), excerpt(instance), actual, bound, {} });
+    }
+
+    void add(ValidationErrorKind kind, const String& location, const JsonValue& instance, const String& detail)
+    {
+        m_records.append({ kind, location, instance_location(), excerpt(instance), 0, 0, detail });
+    }
+
+    // For instances that aren't at hand as a JsonValue, only as their excerpt.
+    void add_with_excerpt(ValidationErrorKind kind, const String& location, const String& instance, double actual = 0, double bound = 0, const String& detail = {})
+    {
+        m_records.append({ kind, location, instance_location(), instance, actual, bound, detail });
+    }
+
     void append(const ValidationError& e)
     {
-        for (auto& error : e.errors()) {
-            add(error);
-        }
+        for (auto& record : e.records())
+            m_records.append(record);
     }
 
-    const Vector<String>& errors() const { return m_errors; }
+    const Vector<ValidationErrorRecord>& records() const { return m_records; }
+
+    // Formats the message of every record.
+    Vector<String> errors() const;
 
-    bool has_error() const { return m_errors.size(); }
+    bool has_error() const { return m_records.size(); }
+
+    // The path to the instance being validated. It is kept as a stack of borrowed keys
+    // and indices and only turned into a JSON pointer when an error is added.
+    void push_instance_key(const String& key) { m_instance_path.append({ &key, 0 }); }
+    void push_instance_index(size_t index) { m_instance_path.append({ nullptr, index }); }
+    void pop_instance_segment() { m_instance_path.take_last(); }
 
 private:
-    Vector<String> m_errors;
+    String instance_location() const;
+
+    struct InstancePathSegment {
+        const String* key;
+        size_t index;
+    };
+
+    Vector<ValidationErrorRecord> m_records;
+    Vector<InstancePathSegment, 32> m_instance_path;
 };
 
+// Adds a segment to the instance location for the lifetime of the scope, if errors are collected.
+class InstanceLocationScope {
+public:
+    InstanceLocationScope(ValidationError* e, const String& key)
+        : m_e(e)
+    {
+        if (m_e)
+            m_e->push_instance_key(key);
+    }
+
+    InstanceLocationScope(ValidationError* e, size_t index)
+        : m_e(e)
+    {
+        if (m_e)
+            m_e->push_instance_index(index);
+    }
+
+    ~InstanceLocationScope()
+    {
+        if (m_e)
+            m_e->pop_instance_segment();
+    }
+
+private:
+    ValidationError* m_e;
+};
+
+// Validates the $defs that objects of the instance embed, every object once. This is
+// a policy for documents that may embed schemas, it is off unless asked for, see
+// Validator::set_validate_embedded_defs(). Errors are only collected if `e` is not null.
+bool validate_embedded_defs(const JsonValue&, ValidationError* e);
+
 struct ValidationResult {
     ValidationError e;
     bool success;
@@ -75,9 +241,29 @@ public:
     Validator() = default;
     ~Validator() = default;
 
+    // Documents that are read are validated while they are read, see StreamingValidator,
+    // unless embedded $defs are validated or a profile is recorded.
     ValidationResult run(const Parser&, const FILE* fd);
     ValidationResult run(const Parser&, const String& filename);
+    ValidationResult run(const Parser&, Core::File&);
     ValidationResult run(const Parser&, const JsonValue& json);
+
+    // Only the verdict, without collecting errors. Stops at the first failure.
+    bool is_valid(const Parser&, const JsonValue& json);
+
+    // Records how often anyOf/oneOf branches match into the profile, see Parser::set_profile().
+    void set_profile(Profile* profile) { m_profile = profile; }
+
+    // Whether objects of the instance may embed $defs, which are then validated too.
+    void set_validate_embedded_defs(bool validate_embedded_defs) { m_validate_embedded_defs = validate_embedded_defs; }
+
+private:
+    // Validates the chunks read_chunk() returns, until it returns an empty one.
+    template<typename ReadChunk>
+    ValidationResult run_on_chunks(const Parser&, ReadChunk read_chunk);
+
+    Profile* m_profile { nullptr };
+    bool m_validate_embedded_defs { false };
 };
 
 }
@@ -0,0 +1,11292 @@
+// Generated by jsonvalidator-generate, do not edit.
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibJsonValidator/EnumSet.h>
+#include <LibJsonValidator/Format.h>
+#include <LibJsonValidator/Keywords.h>
+#include <LibJsonValidator/NumberConstant.h>
+#include <LibJsonValidator/Pattern.h>
+#include <LibJsonValidator/Validator.h>
+#include "GeneratedValidators.h"
+
+static bool validate_additionalItems_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalItems_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_additionalItems_0_sub1(values[0], e);
+        }
+        for (size_t i = 1; i < values.size() && (valid || e); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            valid &= validate_additionalItems_0_sub2(values[i], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalItems_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalItems_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/additionalItems", json, 0, 32);
+        valid = false;
+        goto L4;
+    }
+L4:
+    return valid;
+}
+
+bool validate_additionalItems_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalItems_0_sub0(json, &e);
+}
+
+bool validate_additionalItems_0(const JsonValue& json)
+{
+    return validate_additionalItems_0_sub0(json, nullptr);
+}
+
+static bool validate_additionalItems_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalItems_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_additionalItems_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalItems_1_sub0(json, &e);
+}
+
+bool validate_additionalItems_1(const JsonValue& json)
+{
+    return validate_additionalItems_1_sub0(json, nullptr);
+}
+
+static bool validate_additionalItems_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_2_sub4(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalItems_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_additionalItems_2_sub1(values[0], e);
+        }
+        if (values.size() > 1) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)1);
+            valid &= validate_additionalItems_2_sub2(values[1], e);
+        }
+        if (values.size() > 2) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)2);
+            valid &= validate_additionalItems_2_sub3(values[2], e);
+        }
+        for (size_t i = 3; i < values.size() && (valid || e); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            valid &= validate_additionalItems_2_sub4(values[i], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalItems_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalItems_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalItems_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalItems_2_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/additionalItems", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_additionalItems_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalItems_2_sub0(json, &e);
+}
+
+bool validate_additionalItems_2(const JsonValue& json)
+{
+    return validate_additionalItems_2_sub0(json, nullptr);
+}
+
+static bool validate_additionalItems_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalItems_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_additionalItems_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalItems_3_sub0(json, &e);
+}
+
+bool validate_additionalItems_3(const JsonValue& json)
+{
+    return validate_additionalItems_3_sub0(json, nullptr);
+}
+
+static bool validate_additionalItems_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalItems_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalItems_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_additionalItems_4_sub1(values[0], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalItems_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/0", json, 0, 32);
+        valid = false;
+        goto L4;
+    }
+L4:
+    return valid;
+}
+
+bool validate_additionalItems_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalItems_4_sub0(json, &e);
+}
+
+bool validate_additionalItems_4(const JsonValue& json)
+{
+    return validate_additionalItems_4_sub0(json, nullptr);
+}
+
+static bool validate_additionalProperties_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_0_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_0_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::RegexSet validate_additionalProperties_0_patterns0 = [] {
+    Vector<String> patterns;
+    patterns.append("^v");
+    return JsonValidator::RegexSet(patterns);
+}();
+
+static bool validate_additionalProperties_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                valid &= validate_additionalProperties_0_sub1(value, e);
+                break;
+            }
+            if (key == "foo") {
+                valid &= validate_additionalProperties_0_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            JsonValidator::RegexMatches matches;
+            validate_additionalProperties_0_patterns0.search(key.characters(), key.length(), matches);
+            for (auto pattern : matches) {
+                match = true;
+                switch (pattern) {
+                case 0:
+                    valid &= validate_additionalProperties_0_sub3(value, e);
+                    break;
+                }
+            }
+            if (!match) {
+                if (!validate_additionalProperties_0_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalProperties_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_0_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_0_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/additionalProperties", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_additionalProperties_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalProperties_0_sub0(json, &e);
+}
+
+bool validate_additionalProperties_0(const JsonValue& json)
+{
+    return validate_additionalProperties_0_sub0(json, nullptr);
+}
+
+static bool validate_additionalProperties_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::RegexSet validate_additionalProperties_1_patterns0 = [] {
+    Vector<String> patterns;
+    patterns.append("^\303\241");
+    return JsonValidator::RegexSet(patterns);
+}();
+
+static bool validate_additionalProperties_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            JsonValidator::RegexMatches matches;
+            validate_additionalProperties_1_patterns0.search(key.characters(), key.length(), matches);
+            for (auto pattern : matches) {
+                match = true;
+                switch (pattern) {
+                case 0:
+                    valid &= validate_additionalProperties_1_sub1(value, e);
+                    break;
+                }
+            }
+            if (!match) {
+                if (!validate_additionalProperties_1_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalProperties_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/additionalProperties", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_additionalProperties_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalProperties_1_sub0(json, &e);
+}
+
+bool validate_additionalProperties_1(const JsonValue& json)
+{
+    return validate_additionalProperties_1_sub0(json, nullptr);
+}
+
+static bool validate_additionalProperties_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalProperties_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                valid &= validate_additionalProperties_2_sub1(value, e);
+                break;
+            }
+            if (key == "foo") {
+                valid &= validate_additionalProperties_2_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_additionalProperties_2_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalProperties_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/additionalProperties", json, 0, 2);
+        valid = false;
+        goto L4;
+    }
+L4:
+    return valid;
+}
+
+bool validate_additionalProperties_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalProperties_2_sub0(json, &e);
+}
+
+bool validate_additionalProperties_2(const JsonValue& json)
+{
+    return validate_additionalProperties_2_sub0(json, nullptr);
+}
+
+static bool validate_additionalProperties_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalProperties_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_additionalProperties_3_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalProperties_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/additionalProperties", json, 0, 2);
+        valid = false;
+        goto L4;
+    }
+L4:
+    return valid;
+}
+
+bool validate_additionalProperties_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalProperties_3_sub0(json, &e);
+}
+
+bool validate_additionalProperties_3(const JsonValue& json)
+{
+    return validate_additionalProperties_3_sub0(json, nullptr);
+}
+
+static bool validate_additionalProperties_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_4_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_4_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalProperties_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                valid &= validate_additionalProperties_4_sub1(value, e);
+                break;
+            }
+            if (key == "foo") {
+                valid &= validate_additionalProperties_4_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_additionalProperties_4_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_additionalProperties_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_4_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_4_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_additionalProperties_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalProperties_4_sub0(json, &e);
+}
+
+bool validate_additionalProperties_4(const JsonValue& json)
+{
+    return validate_additionalProperties_4_sub0(json, nullptr);
+}
+
+static bool validate_additionalProperties_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_5_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_5_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_additionalProperties_5_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_additionalProperties_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_additionalProperties_5_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_additionalProperties_5_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L4;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_additionalProperties_5_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L4:
+    return valid;
+}
+
+static bool validate_additionalProperties_5_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_5_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_additionalProperties_5_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/additionalProperties", json, 0, 2);
+        valid = false;
+        goto L6;
+    }
+L6:
+    return valid;
+}
+
+bool validate_additionalProperties_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_additionalProperties_5_sub0(json, &e);
+}
+
+bool validate_additionalProperties_5(const JsonValue& json)
+{
+    return validate_additionalProperties_5_sub0(json, nullptr);
+}
+
+static bool validate_allOf_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_0_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_0_sub4(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x1u;
+                valid &= validate_allOf_0_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_allOf_0_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L2:
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L4;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_allOf_0_sub3(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_allOf_0_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo");
+        valid = false;
+    }
+    }
+    }
+L4:
+    return valid;
+}
+
+static bool validate_allOf_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/allOf/0/properties/bar", json, 0, 32);
+        valid = false;
+        goto L12;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/allOf/0/properties/bar", json);
+        valid = false;
+        goto L12;
+    }
+L12:
+    return valid;
+}
+
+static bool validate_allOf_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_allOf_0_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/allOf/1/properties/foo", json, 0, 16);
+        valid = false;
+        goto L8;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/allOf/1/properties/foo", json);
+        valid = false;
+        goto L8;
+    }
+L8:
+    return valid;
+}
+
+static bool validate_allOf_0_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_allOf_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_0_sub0(json, &e);
+}
+
+bool validate_allOf_0(const JsonValue& json)
+{
+    return validate_allOf_0_sub0(json, nullptr);
+}
+
+static bool validate_allOf_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_1_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_1_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_1_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_allOf_1_sub6(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_allOf_1_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_allOf_1_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo");
+        valid = false;
+    }
+    }
+    }
+L2:
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L4;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "baz") {
+                present[0] |= 0x1u;
+                valid &= validate_allOf_1_sub3(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_allOf_1_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "baz");
+        valid = false;
+    }
+    }
+    }
+L4:
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L6;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x1u;
+                valid &= validate_allOf_1_sub5(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_allOf_1_sub6(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L6:
+    return valid;
+}
+
+static bool validate_allOf_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/allOf/0/properties/foo", json, 0, 16);
+        valid = false;
+        goto L18;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/allOf/0/properties/foo", json);
+        valid = false;
+        goto L18;
+    }
+L18:
+    return valid;
+}
+
+static bool validate_allOf_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_allOf_1_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x01)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/allOf/1/properties/baz", json, 0, 1);
+        valid = false;
+        goto L14;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/allOf/1/properties/baz", json);
+        valid = false;
+        goto L14;
+    }
+L14:
+    return valid;
+}
+
+static bool validate_allOf_1_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_allOf_1_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/bar", json, 0, 32);
+        valid = false;
+        goto L10;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/properties/bar", json);
+        valid = false;
+        goto L10;
+    }
+L10:
+    return valid;
+}
+
+static bool validate_allOf_1_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_allOf_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_1_sub0(json, &e);
+}
+
+bool validate_allOf_1(const JsonValue& json)
+{
+    return validate_allOf_1_sub0(json, nullptr);
+}
+
+static bool validate_allOf_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_allOf_2_number0((i64)30LL);
+static const JsonValidator::NumberConstant validate_allOf_2_number1((i64)20LL);
+
+static bool validate_allOf_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_allOf_2_number0.compare(json) > 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Maximum, "#", json, json.to_number<double>(), validate_allOf_2_number0.value());
+        valid = false;
+    }
+L2:
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L4;
+    if (validate_allOf_2_number1.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#", json, json.to_number<double>(), validate_allOf_2_number1.value());
+        valid = false;
+    }
+L4:
+    return valid;
+}
+
+bool validate_allOf_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_2_sub0(json, &e);
+}
+
+bool validate_allOf_2(const JsonValue& json)
+{
+    return validate_allOf_2_sub0(json, nullptr);
+}
+
+static bool validate_allOf_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_allOf_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_3_sub0(json, &e);
+}
+
+bool validate_allOf_3(const JsonValue& json)
+{
+    return validate_allOf_3_sub0(json, nullptr);
+}
+
+static bool validate_allOf_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_allOf_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_4_sub0(json, &e);
+}
+
+bool validate_allOf_4(const JsonValue& json)
+{
+    return validate_allOf_4_sub0(json, nullptr);
+}
+
+static bool validate_allOf_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#", json);
+        valid = false;
+    }
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_allOf_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_5_sub0(json, &e);
+}
+
+bool validate_allOf_5(const JsonValue& json)
+{
+    return validate_allOf_5_sub0(json, nullptr);
+}
+
+static bool validate_allOf_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_allOf_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_6_sub0(json, &e);
+}
+
+bool validate_allOf_6(const JsonValue& json)
+{
+    return validate_allOf_6_sub0(json, nullptr);
+}
+
+static bool validate_allOf_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_allOf_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_7_sub0(json, &e);
+}
+
+bool validate_allOf_7(const JsonValue& json)
+{
+    return validate_allOf_7_sub0(json, nullptr);
+}
+
+static bool validate_allOf_8_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_8_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 96);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_allOf_8(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_8_sub0(json, &e);
+}
+
+bool validate_allOf_8(const JsonValue& json)
+{
+    return validate_allOf_8_sub0(json, nullptr);
+}
+
+static bool validate_allOf_9_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_allOf_9_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 96);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_allOf_9(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_allOf_9_sub0(json, &e);
+}
+
+bool validate_allOf_9(const JsonValue& json)
+{
+    return validate_allOf_9_sub0(json, nullptr);
+}
+
+static bool validate_anchor_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anchor_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anchor_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_anchor_0_sub1(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_anchor_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/A", json, 0, 32);
+        valid = false;
+        goto L3;
+    }
+L3:
+    return valid;
+}
+
+bool validate_anchor_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anchor_0_sub0(json, &e);
+}
+
+bool validate_anchor_0(const JsonValue& json)
+{
+    return validate_anchor_0_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_anyOf_0_number0((i64)2LL);
+
+static bool validate_anyOf_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_anyOf_0_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 1)
+        goto L4;
+    if (validate_anyOf_0_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_anyOf_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/0", json, 0, 32);
+        valid = false;
+        goto L10;
+    }
+L10:
+    return valid;
+}
+
+static bool validate_anyOf_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L8;
+    if (validate_anyOf_0_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#/anyOf/1", json, json.to_number<double>(), validate_anyOf_0_number0.value());
+        valid = false;
+    }
+L8:
+    return valid;
+}
+
+bool validate_anyOf_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_0_sub0(json, &e);
+}
+
+bool validate_anyOf_0(const JsonValue& json)
+{
+    return validate_anyOf_0_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 16);
+        valid = false;
+        goto L6;
+    }
+    matches = 0;
+    if (validate_anyOf_1_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 1)
+        goto L5;
+    if (validate_anyOf_1_sub2(json, nullptr))
+        ++matches;
+L5:
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#", json);
+        valid = false;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_anyOf_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L12;
+    if (JsonValidator::exceeds_max_length(json.as_string(), 2)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxLength, "#/anyOf/0", json);
+        valid = false;
+    }
+L12:
+    return valid;
+}
+
+static bool validate_anyOf_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L9;
+    if (JsonValidator::below_min_length(json.as_string(), 4)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinLength, "#/anyOf/1", json);
+        valid = false;
+    }
+L9:
+    return valid;
+}
+
+bool validate_anyOf_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_1_sub0(json, &e);
+}
+
+bool validate_anyOf_1(const JsonValue& json)
+{
+    return validate_anyOf_1_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_anyOf_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_2_sub0(json, &e);
+}
+
+bool validate_anyOf_2(const JsonValue& json)
+{
+    return validate_anyOf_2_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_anyOf_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_3_sub0(json, &e);
+}
+
+bool validate_anyOf_3(const JsonValue& json)
+{
+    return validate_anyOf_3_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_anyOf_4_sub1(json, nullptr))
+        ++matches;
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_anyOf_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/anyOf/1", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_anyOf_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_4_sub0(json, &e);
+}
+
+bool validate_anyOf_4(const JsonValue& json)
+{
+    return validate_anyOf_4_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_5_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_5_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_5_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_5_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_5_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_5_sub6(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_anyOf_5_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 1)
+        goto L4;
+    if (validate_anyOf_5_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_anyOf_5_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L15;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x1u;
+                valid &= validate_anyOf_5_sub5(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_anyOf_5_sub6(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/anyOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/0", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L15:
+    return valid;
+}
+
+static bool validate_anyOf_5_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L8;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_anyOf_5_sub3(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_anyOf_5_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/anyOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/1", json, "foo");
+        valid = false;
+    }
+    }
+    }
+L8:
+    return valid;
+}
+
+static bool validate_anyOf_5_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/1/properties/foo", json, 0, 16);
+        valid = false;
+        goto L12;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/1/properties/foo", json);
+        valid = false;
+        goto L12;
+    }
+L12:
+    return valid;
+}
+
+static bool validate_anyOf_5_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_anyOf_5_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/0/properties/bar", json, 0, 32);
+        valid = false;
+        goto L19;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/0/properties/bar", json);
+        valid = false;
+        goto L19;
+    }
+L19:
+    return valid;
+}
+
+static bool validate_anyOf_5_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_anyOf_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_5_sub0(json, &e);
+}
+
+bool validate_anyOf_5(const JsonValue& json)
+{
+    return validate_anyOf_5_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_anyOf_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_6_sub0(json, &e);
+}
+
+bool validate_anyOf_6(const JsonValue& json)
+{
+    return validate_anyOf_6_sub0(json, nullptr);
+}
+
+static bool validate_anyOf_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_7_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_anyOf_7_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_anyOf_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_anyOf_7_sub1(json, nullptr))
+        ++matches;
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_anyOf_7_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_anyOf_7_sub2(json, nullptr))
+        ++matches;
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#/anyOf/0", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_anyOf_7_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x01)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/0/anyOf/0", json, 0, 1);
+        valid = false;
+        goto L9;
+    }
+L9:
+    return valid;
+}
+
+bool validate_anyOf_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_anyOf_7_sub0(json, &e);
+}
+
+bool validate_anyOf_7(const JsonValue& json)
+{
+    return validate_anyOf_7_sub0(json, nullptr);
+}
+
+static bool validate_boolean_schema_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_boolean_schema_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_boolean_schema_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_boolean_schema_0_sub0(json, &e);
+}
+
+bool validate_boolean_schema_0(const JsonValue& json)
+{
+    return validate_boolean_schema_0_sub0(json, nullptr);
+}
+
+static bool validate_boolean_schema_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_boolean_schema_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_boolean_schema_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_boolean_schema_1_sub0(json, &e);
+}
+
+bool validate_boolean_schema_1(const JsonValue& json)
+{
+    return validate_boolean_schema_1_sub0(json, nullptr);
+}
+
+static bool validate_const_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 2.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_0_sub0(json, &e);
+}
+
+bool validate_const_0(const JsonValue& json)
+{
+    return validate_const_0_sub0(json, nullptr);
+}
+
+static bool validate_const_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValue validate_const_1_value0 = JsonValue::from_string("{\"foo\":\"bar\",\"baz\":\"bax\"}");
+
+static bool validate_const_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(validate_const_1_value0.equals(json))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_1_sub0(json, &e);
+}
+
+bool validate_const_1(const JsonValue& json)
+{
+    return validate_const_1_sub0(json, nullptr);
+}
+
+static bool validate_const_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValue validate_const_2_value0 = JsonValue::from_string("[{\"foo\":\"bar\"}]");
+
+static bool validate_const_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(validate_const_2_value0.equals(json))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_2_sub0(json, &e);
+}
+
+bool validate_const_2(const JsonValue& json)
+{
+    return validate_const_2_sub0(json, nullptr);
+}
+
+static bool validate_const_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(json.is_null())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_3_sub0(json, &e);
+}
+
+bool validate_const_3(const JsonValue& json)
+{
+    return validate_const_3_sub0(json, nullptr);
+}
+
+static bool validate_const_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_bool() && json.as_bool() == false))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_4_sub0(json, &e);
+}
+
+bool validate_const_4(const JsonValue& json)
+{
+    return validate_const_4_sub0(json, nullptr);
+}
+
+static bool validate_const_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_bool() && json.as_bool() == true))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_5_sub0(json, &e);
+}
+
+bool validate_const_5(const JsonValue& json)
+{
+    return validate_const_5_sub0(json, nullptr);
+}
+
+static bool validate_const_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 0.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_6_sub0(json, &e);
+}
+
+bool validate_const_6(const JsonValue& json)
+{
+    return validate_const_6_sub0(json, nullptr);
+}
+
+static bool validate_const_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 1.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_7_sub0(json, &e);
+}
+
+bool validate_const_7(const JsonValue& json)
+{
+    return validate_const_7_sub0(json, nullptr);
+}
+
+static bool validate_const_8_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_8_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == -2.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_8(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_8_sub0(json, &e);
+}
+
+bool validate_const_8(const JsonValue& json)
+{
+    return validate_const_8_sub0(json, nullptr);
+}
+
+static bool validate_const_9_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_const_9_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 9007199254740992.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_const_9(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_const_9_sub0(json, &e);
+}
+
+bool validate_const_9(const JsonValue& json)
+{
+    return validate_const_9_sub0(json, nullptr);
+}
+
+static bool validate_contains_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_contains_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_contains_0_number0((i64)5LL);
+
+static bool validate_contains_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        bool contains_valid = false;
+        for (auto& value : json.as_array().values()) {
+            if (validate_contains_0_sub1(value, nullptr)) {
+                contains_valid = true;
+                break;
+            }
+        }
+        if (!contains_valid) {
+            if (!e)
+                return false;
+            e->add(JsonValidator::ValidationErrorKind::Contains, "#", json);
+            valid = false;
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_contains_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L5;
+    if (validate_contains_0_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#/contains", json, json.to_number<double>(), validate_contains_0_number0.value());
+        valid = false;
+    }
+L5:
+    return valid;
+}
+
+bool validate_contains_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_contains_0_sub0(json, &e);
+}
+
+bool validate_contains_0(const JsonValue& json)
+{
+    return validate_contains_0_sub0(json, nullptr);
+}
+
+static bool validate_contains_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_contains_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_contains_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        bool contains_valid = false;
+        for (auto& value : json.as_array().values()) {
+            if (validate_contains_1_sub1(value, nullptr)) {
+                contains_valid = true;
+                break;
+            }
+        }
+        if (!contains_valid) {
+            if (!e)
+                return false;
+            e->add(JsonValidator::ValidationErrorKind::Contains, "#", json);
+            valid = false;
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_contains_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 5.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/contains", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_contains_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_contains_1_sub0(json, &e);
+}
+
+bool validate_contains_1(const JsonValue& json)
+{
+    return validate_contains_1_sub0(json, nullptr);
+}
+
+static bool validate_contains_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_contains_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_contains_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        bool contains_valid = false;
+        for (auto& value : json.as_array().values()) {
+            if (validate_contains_2_sub1(value, nullptr)) {
+                contains_valid = true;
+                break;
+            }
+        }
+        if (!contains_valid) {
+            if (!e)
+                return false;
+            e->add(JsonValidator::ValidationErrorKind::Contains, "#", json);
+            valid = false;
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_contains_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_contains_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_contains_2_sub0(json, &e);
+}
+
+bool validate_contains_2(const JsonValue& json)
+{
+    return validate_contains_2_sub0(json, nullptr);
+}
+
+static bool validate_contains_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_contains_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_contains_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        bool contains_valid = false;
+        for (auto& value : json.as_array().values()) {
+            if (validate_contains_3_sub1(value, nullptr)) {
+                contains_valid = true;
+                break;
+            }
+        }
+        if (!contains_valid) {
+            if (!e)
+                return false;
+            e->add(JsonValidator::ValidationErrorKind::Contains, "#", json);
+            valid = false;
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_contains_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/contains", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_contains_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_contains_3_sub0(json, &e);
+}
+
+bool validate_contains_3(const JsonValue& json)
+{
+    return validate_contains_3_sub0(json, nullptr);
+}
+
+static bool validate_default_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_default_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_default_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_default_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_default_0_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_default_0_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_default_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/foo", json, 0, 32);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+static bool validate_default_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_default_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_default_0_sub0(json, &e);
+}
+
+bool validate_default_0(const JsonValue& json)
+{
+    return validate_default_0_sub0(json, nullptr);
+}
+
+static bool validate_default_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_default_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_default_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_default_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                valid &= validate_default_1_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_default_1_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_default_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/bar", json, 0, 16);
+        valid = false;
+        goto L6;
+    }
+    if (JsonValidator::below_min_length(json.as_string(), 4)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinLength, "#/properties/bar", json);
+        valid = false;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_default_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_default_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_default_1_sub0(json, &e);
+}
+
+bool validate_default_1(const JsonValue& json)
+{
+    return validate_default_1_sub0(json, nullptr);
+}
+
+static bool validate_defs_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_defs_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_defs_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_defs_0_sub0(json, &e);
+}
+
+bool validate_defs_0(const JsonValue& json)
+{
+    return validate_defs_0_sub0(json, nullptr);
+}
+
+static bool validate_defs_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_defs_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_defs_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_defs_1_sub0(json, &e);
+}
+
+bool validate_defs_1(const JsonValue& json)
+{
+    return validate_defs_1_sub0(json, nullptr);
+}
+
+static bool validate_dependentRequired_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentRequired_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentRequired_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x2u;
+                declared = false;
+                break;
+            }
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentRequired_0_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if (present[0] & 0x2u) {
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentRequired, "#", json, "foo");
+        valid = false;
+    }
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_dependentRequired_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentRequired_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentRequired_0_sub0(json, &e);
+}
+
+bool validate_dependentRequired_0(const JsonValue& json)
+{
+    return validate_dependentRequired_0_sub0(json, nullptr);
+}
+
+static bool validate_dependentRequired_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentRequired_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentRequired_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentRequired_1_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if (present[0] & 0x1u) {
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_dependentRequired_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentRequired_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentRequired_1_sub0(json, &e);
+}
+
+bool validate_dependentRequired_1(const JsonValue& json)
+{
+    return validate_dependentRequired_1_sub0(json, nullptr);
+}
+
+static bool validate_dependentRequired_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentRequired_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentRequired_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x2u;
+                declared = false;
+                break;
+            }
+            if (key == "foo") {
+                present[0] |= 0x4u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        case 4:
+            if (key == "quux") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentRequired_2_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if (present[0] & 0x1u) {
+    if ((present[0] & 0x6u) != 0x6u) {
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentRequired, "#", json, "bar");
+        valid = false;
+    }
+    if (!(present[0] & 0x4u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentRequired, "#", json, "foo");
+        valid = false;
+    }
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_dependentRequired_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentRequired_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentRequired_2_sub0(json, &e);
+}
+
+bool validate_dependentRequired_2(const JsonValue& json)
+{
+    return validate_dependentRequired_2_sub0(json, nullptr);
+}
+
+static bool validate_dependentRequired_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentRequired_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentRequired_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 7:
+            if (key == "foo\012bar") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\015bar") {
+                present[0] |= 0x2u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\"bar") {
+                present[0] |= 0x4u;
+                declared = false;
+                break;
+            }
+            if (key == "foo'bar") {
+                present[0] |= 0x8u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentRequired_3_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if (present[0] & 0x4u) {
+    if ((present[0] & 0x8u) != 0x8u) {
+    if (!(present[0] & 0x8u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentRequired, "#", json, "foo'bar");
+        valid = false;
+    }
+    }
+    }
+    if (present[0] & 0x1u) {
+    if ((present[0] & 0x2u) != 0x2u) {
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentRequired, "#", json, "foo\015bar");
+        valid = false;
+    }
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_dependentRequired_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentRequired_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentRequired_3_sub0(json, &e);
+}
+
+bool validate_dependentRequired_3(const JsonValue& json)
+{
+    return validate_dependentRequired_3_sub0(json, nullptr);
+}
+
+static bool validate_dependentSchemas_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_0_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_0_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_0_sub5(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentSchemas_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L3;
+    if (json.as_object().has("bar") && !validate_dependentSchemas_0_sub1(json, e)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentSchema, "#", json);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentSchemas_0_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L3:
+    return valid;
+}
+
+static bool validate_dependentSchemas_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L7;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                valid &= validate_dependentSchemas_0_sub3(value, e);
+                break;
+            }
+            if (key == "foo") {
+                valid &= validate_dependentSchemas_0_sub4(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentSchemas_0_sub5(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/dependentSchemas/bar", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L7:
+    return valid;
+}
+
+static bool validate_dependentSchemas_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_dependentSchemas_0_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/dependentSchemas/bar/properties/bar", json, 0, 32);
+        valid = false;
+        goto L12;
+    }
+L12:
+    return valid;
+}
+
+static bool validate_dependentSchemas_0_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/dependentSchemas/bar/properties/foo", json, 0, 32);
+        valid = false;
+        goto L10;
+    }
+L10:
+    return valid;
+}
+
+static bool validate_dependentSchemas_0_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentSchemas_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentSchemas_0_sub0(json, &e);
+}
+
+bool validate_dependentSchemas_0(const JsonValue& json)
+{
+    return validate_dependentSchemas_0_sub0(json, nullptr);
+}
+
+static bool validate_dependentSchemas_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentSchemas_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L3;
+    if (json.as_object().has("bar") && !validate_dependentSchemas_1_sub1(json, e)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentSchema, "#", json);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentSchemas_1_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L3:
+    return valid;
+}
+
+static bool validate_dependentSchemas_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/dependentSchemas/bar", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_dependentSchemas_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentSchemas_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentSchemas_1_sub0(json, &e);
+}
+
+bool validate_dependentSchemas_1(const JsonValue& json)
+{
+    return validate_dependentSchemas_1_sub0(json, nullptr);
+}
+
+static bool validate_dependentSchemas_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_2_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_dependentSchemas_2_sub5(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_dependentSchemas_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L4;
+    if (json.as_object().has("foo'bar") && !validate_dependentSchemas_2_sub1(json, e)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentSchema, "#", json);
+        valid = false;
+    }
+    if (json.as_object().has("foo\011bar") && !validate_dependentSchemas_2_sub2(json, e)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::DependentSchema, "#", json);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentSchemas_2_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L4:
+    return valid;
+}
+
+static bool validate_dependentSchemas_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L13;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 7:
+            if (key == "foo\"bar") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentSchemas_2_sub5(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/dependentSchemas/foo'bar", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/dependentSchemas/foo'bar", json, "foo\"bar");
+        valid = false;
+    }
+    }
+    }
+L13:
+    return valid;
+}
+
+static bool validate_dependentSchemas_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L9;
+    if (json.as_object().size() < 4) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinProperties, "#/dependentSchemas/foo\011bar", json, json.as_object().size(), 4);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_dependentSchemas_2_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/dependentSchemas/foo\011bar", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L9:
+    return valid;
+}
+
+static bool validate_dependentSchemas_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_dependentSchemas_2_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_dependentSchemas_2_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_dependentSchemas_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_dependentSchemas_2_sub0(json, &e);
+}
+
+bool validate_dependentSchemas_2(const JsonValue& json)
+{
+    return validate_dependentSchemas_2_sub0(json, nullptr);
+}
+
+static bool validate_enum_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 1.0)
+        || (json.is_number() && json.to_number<double>() == 2.0)
+        || (json.is_number() && json.to_number<double>() == 3.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_0_sub0(json, &e);
+}
+
+bool validate_enum_0(const JsonValue& json)
+{
+    return validate_enum_0_sub0(json, nullptr);
+}
+
+static bool validate_enum_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValue validate_enum_1_value0 = JsonValue::from_string("[]");
+static const JsonValue validate_enum_1_value1 = JsonValue::from_string("{\"foo\":12}");
+
+static bool validate_enum_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 6.0)
+        || (json.is_string() && json.as_string() == "foo")
+        || validate_enum_1_value0.equals(json)
+        || (json.is_bool() && json.as_bool() == true)
+        || validate_enum_1_value1.equals(json))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_1_sub0(json, &e);
+}
+
+bool validate_enum_1(const JsonValue& json)
+{
+    return validate_enum_1_sub0(json, nullptr);
+}
+
+static bool validate_enum_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_enum_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_enum_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_enum_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 4);
+        valid = false;
+        goto L2;
+    }
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x2u;
+                valid &= validate_enum_2_sub1(value, e);
+                break;
+            }
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_enum_2_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_enum_2_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x2u) != 0x2u) {
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_enum_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/properties/bar", json);
+        valid = false;
+        goto L8;
+    }
+    if (!((json.is_string() && json.as_string() == "bar"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/properties/bar", json);
+        valid = false;
+    }
+L8:
+    return valid;
+}
+
+static bool validate_enum_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_string() && json.as_string() == "foo"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/properties/foo", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_enum_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_enum_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_2_sub0(json, &e);
+}
+
+bool validate_enum_2(const JsonValue& json)
+{
+    return validate_enum_2_sub0(json, nullptr);
+}
+
+static bool validate_enum_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_string() && json.as_string() == "foo\012bar")
+        || (json.is_string() && json.as_string() == "foo\015bar"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_3_sub0(json, &e);
+}
+
+bool validate_enum_3(const JsonValue& json)
+{
+    return validate_enum_3_sub0(json, nullptr);
+}
+
+static bool validate_enum_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_bool() && json.as_bool() == false))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_4_sub0(json, &e);
+}
+
+bool validate_enum_4(const JsonValue& json)
+{
+    return validate_enum_4_sub0(json, nullptr);
+}
+
+static bool validate_enum_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_bool() && json.as_bool() == true))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_5_sub0(json, &e);
+}
+
+bool validate_enum_5(const JsonValue& json)
+{
+    return validate_enum_5_sub0(json, nullptr);
+}
+
+static bool validate_enum_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 0.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_6_sub0(json, &e);
+}
+
+bool validate_enum_6(const JsonValue& json)
+{
+    return validate_enum_6_sub0(json, nullptr);
+}
+
+static bool validate_enum_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_enum_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!((json.is_number() && json.to_number<double>() == 1.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_enum_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_enum_7_sub0(json, &e);
+}
+
+bool validate_enum_7(const JsonValue& json)
+{
+    return validate_enum_7_sub0(json, nullptr);
+}
+
+static bool validate_exclusiveMaximum_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_exclusiveMaximum_0_number0((i64)3LL);
+
+static bool validate_exclusiveMaximum_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_exclusiveMaximum_0_number0.compare(json) >= 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::ExclusiveMaximum, "#", json, json.to_number<double>(), validate_exclusiveMaximum_0_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_exclusiveMaximum_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_exclusiveMaximum_0_sub0(json, &e);
+}
+
+bool validate_exclusiveMaximum_0(const JsonValue& json)
+{
+    return validate_exclusiveMaximum_0_sub0(json, nullptr);
+}
+
+static bool validate_exclusiveMinimum_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_exclusiveMinimum_0_number0(1.1000000000000001);
+
+static bool validate_exclusiveMinimum_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_exclusiveMinimum_0_number0.compare(json) <= 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::ExclusiveMinimum, "#", json, json.to_number<double>(), validate_exclusiveMinimum_0_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_exclusiveMinimum_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_exclusiveMinimum_0_sub0(json, &e);
+}
+
+bool validate_exclusiveMinimum_0(const JsonValue& json)
+{
+    return validate_exclusiveMinimum_0_sub0(json, nullptr);
+}
+
+static bool validate_format_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Email, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 6);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_0_sub0(json, &e);
+}
+
+bool validate_format_0(const JsonValue& json)
+{
+    return validate_format_0_sub0(json, nullptr);
+}
+
+static bool validate_format_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_1_sub0(json, &e);
+}
+
+bool validate_format_1(const JsonValue& json)
+{
+    return validate_format_1_sub0(json, nullptr);
+}
+
+static bool validate_format_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_2_sub0(json, &e);
+}
+
+bool validate_format_2(const JsonValue& json)
+{
+    return validate_format_2_sub0(json, nullptr);
+}
+
+static bool validate_format_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::IPv4, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 3);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_3_sub0(json, &e);
+}
+
+bool validate_format_3(const JsonValue& json)
+{
+    return validate_format_3_sub0(json, nullptr);
+}
+
+static bool validate_format_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::IPv6, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 4);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_4_sub0(json, &e);
+}
+
+bool validate_format_4(const JsonValue& json)
+{
+    return validate_format_4_sub0(json, nullptr);
+}
+
+static bool validate_format_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_5_sub0(json, &e);
+}
+
+bool validate_format_5(const JsonValue& json)
+{
+    return validate_format_5_sub0(json, nullptr);
+}
+
+static bool validate_format_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Hostname, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 7);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_6_sub0(json, &e);
+}
+
+bool validate_format_6(const JsonValue& json)
+{
+    return validate_format_6_sub0(json, nullptr);
+}
+
+static bool validate_format_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Date, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 1);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_7_sub0(json, &e);
+}
+
+bool validate_format_7(const JsonValue& json)
+{
+    return validate_format_7_sub0(json, nullptr);
+}
+
+static bool validate_format_8_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_8_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::DateTime, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 0);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_8(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_8_sub0(json, &e);
+}
+
+bool validate_format_8(const JsonValue& json)
+{
+    return validate_format_8_sub0(json, nullptr);
+}
+
+static bool validate_format_9_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_9_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Time, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 2);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_9(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_9_sub0(json, &e);
+}
+
+bool validate_format_9(const JsonValue& json)
+{
+    return validate_format_9_sub0(json, nullptr);
+}
+
+static bool validate_format_10_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_10_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_10(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_10_sub0(json, &e);
+}
+
+bool validate_format_10(const JsonValue& json)
+{
+    return validate_format_10_sub0(json, nullptr);
+}
+
+static bool validate_format_11_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_11_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_11(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_11_sub0(json, &e);
+}
+
+bool validate_format_11(const JsonValue& json)
+{
+    return validate_format_11_sub0(json, nullptr);
+}
+
+static bool validate_format_12_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_12_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_12(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_12_sub0(json, &e);
+}
+
+bool validate_format_12(const JsonValue& json)
+{
+    return validate_format_12_sub0(json, nullptr);
+}
+
+static bool validate_format_13_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_13_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_13(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_13_sub0(json, &e);
+}
+
+bool validate_format_13(const JsonValue& json)
+{
+    return validate_format_13_sub0(json, nullptr);
+}
+
+static bool validate_format_14_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_14_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::URI, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 8);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_format_14(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_14_sub0(json, &e);
+}
+
+bool validate_format_14(const JsonValue& json)
+{
+    return validate_format_14_sub0(json, nullptr);
+}
+
+static bool validate_format_15_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_15_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_15(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_15_sub0(json, &e);
+}
+
+bool validate_format_15(const JsonValue& json)
+{
+    return validate_format_15_sub0(json, nullptr);
+}
+
+static bool validate_format_16_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_format_16_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_format_16(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_format_16_sub0(json, &e);
+}
+
+bool validate_format_16(const JsonValue& json)
+{
+    return validate_format_16_sub0(json, nullptr);
+}
+
+static bool validate_items_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_items_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_items_0_sub1(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_items_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items", json, 0, 32);
+        valid = false;
+        goto L4;
+    }
+L4:
+    return valid;
+}
+
+bool validate_items_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_items_0_sub0(json, &e);
+}
+
+bool validate_items_0(const JsonValue& json)
+{
+    return validate_items_0_sub0(json, nullptr);
+}
+
+static bool validate_items_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_items_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_items_1_sub1(values[0], e);
+        }
+        if (values.size() > 1) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)1);
+            valid &= validate_items_1_sub2(values[1], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_items_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/0", json, 0, 32);
+        valid = false;
+        goto L6;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_items_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/1", json, 0, 16);
+        valid = false;
+        goto L4;
+    }
+L4:
+    return valid;
+}
+
+bool validate_items_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_items_1_sub0(json, &e);
+}
+
+bool validate_items_1(const JsonValue& json)
+{
+    return validate_items_1_sub0(json, nullptr);
+}
+
+static bool validate_items_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_items_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_items_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_items_2_sub0(json, &e);
+}
+
+bool validate_items_2(const JsonValue& json)
+{
+    return validate_items_2_sub0(json, nullptr);
+}
+
+static bool validate_items_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_items_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_items_3_sub1(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_items_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/items", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_items_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_items_3_sub0(json, &e);
+}
+
+bool validate_items_3(const JsonValue& json)
+{
+    return validate_items_3_sub0(json, nullptr);
+}
+
+static bool validate_items_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_4_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_items_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_items_4_sub1(values[0], e);
+        }
+        if (values.size() > 1) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)1);
+            valid &= validate_items_4_sub2(values[1], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_items_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_items_4_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/items/1", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_items_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_items_4_sub0(json, &e);
+}
+
+bool validate_items_4(const JsonValue& json)
+{
+    return validate_items_4_sub0(json, nullptr);
+}
+
+static bool validate_items_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_5_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_5_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_5_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_items_5_sub4(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_items_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 8);
+        valid = false;
+        goto L2;
+    }
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_items_5_sub1(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_items_5_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items", json, 0, 8);
+        valid = false;
+        goto L5;
+    }
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_items_5_sub2(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L5:
+    return valid;
+}
+
+static bool validate_items_5_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/items", json, 0, 8);
+        valid = false;
+        goto L8;
+    }
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_items_5_sub3(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L8:
+    return valid;
+}
+
+static bool validate_items_5_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/items/items", json, 0, 8);
+        valid = false;
+        goto L11;
+    }
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_items_5_sub4(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L11:
+    return valid;
+}
+
+static bool validate_items_5_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/items/items/items", json, 0, 96);
+        valid = false;
+        goto L13;
+    }
+L13:
+    return valid;
+}
+
+bool validate_items_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_items_5_sub0(json, &e);
+}
+
+bool validate_items_5(const JsonValue& json)
+{
+    return validate_items_5_sub0(json, nullptr);
+}
+
+static bool validate_maxItems_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_maxItems_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    if (json.as_array().values().size() > 2) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxItems, "#", json, json.as_array().values().size(), 2);
+        valid = false;
+        goto L2;
+    }
+L2:
+    return valid;
+}
+
+bool validate_maxItems_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_maxItems_0_sub0(json, &e);
+}
+
+bool validate_maxItems_0(const JsonValue& json)
+{
+    return validate_maxItems_0_sub0(json, nullptr);
+}
+
+static bool validate_maxLength_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_maxLength_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L2;
+    if (JsonValidator::exceeds_max_length(json.as_string(), 2)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxLength, "#", json);
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_maxLength_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_maxLength_0_sub0(json, &e);
+}
+
+bool validate_maxLength_0(const JsonValue& json)
+{
+    return validate_maxLength_0_sub0(json, nullptr);
+}
+
+static bool validate_maxProperties_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_maxProperties_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_maxProperties_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L3;
+    if (json.as_object().size() > 2) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxProperties, "#", json, json.as_object().size(), 2);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_maxProperties_0_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L3:
+    return valid;
+}
+
+static bool validate_maxProperties_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_maxProperties_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_maxProperties_0_sub0(json, &e);
+}
+
+bool validate_maxProperties_0(const JsonValue& json)
+{
+    return validate_maxProperties_0_sub0(json, nullptr);
+}
+
+static bool validate_maximum_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_maximum_0_number0((i64)3LL);
+
+static bool validate_maximum_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_maximum_0_number0.compare(json) > 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Maximum, "#", json, json.to_number<double>(), validate_maximum_0_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_maximum_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_maximum_0_sub0(json, &e);
+}
+
+bool validate_maximum_0(const JsonValue& json)
+{
+    return validate_maximum_0_sub0(json, nullptr);
+}
+
+static bool validate_maximum_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_maximum_1_number0((i64)300LL);
+
+static bool validate_maximum_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_maximum_1_number0.compare(json) > 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Maximum, "#", json, json.to_number<double>(), validate_maximum_1_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_maximum_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_maximum_1_sub0(json, &e);
+}
+
+bool validate_maximum_1(const JsonValue& json)
+{
+    return validate_maximum_1_sub0(json, nullptr);
+}
+
+static bool validate_minItems_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_minItems_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    if (json.as_array().values().size() < 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinItems, "#", json, json.as_array().values().size(), 1);
+        valid = false;
+        goto L2;
+    }
+L2:
+    return valid;
+}
+
+bool validate_minItems_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_minItems_0_sub0(json, &e);
+}
+
+bool validate_minItems_0(const JsonValue& json)
+{
+    return validate_minItems_0_sub0(json, nullptr);
+}
+
+static bool validate_minLength_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_minLength_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L2;
+    if (JsonValidator::below_min_length(json.as_string(), 2)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinLength, "#", json);
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_minLength_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_minLength_0_sub0(json, &e);
+}
+
+bool validate_minLength_0(const JsonValue& json)
+{
+    return validate_minLength_0_sub0(json, nullptr);
+}
+
+static bool validate_minProperties_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_minProperties_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_minProperties_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L3;
+    if (json.as_object().size() < 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinProperties, "#", json, json.as_object().size(), 1);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_minProperties_0_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L3:
+    return valid;
+}
+
+static bool validate_minProperties_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_minProperties_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_minProperties_0_sub0(json, &e);
+}
+
+bool validate_minProperties_0(const JsonValue& json)
+{
+    return validate_minProperties_0_sub0(json, nullptr);
+}
+
+static bool validate_minimum_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_minimum_0_number0(1.1000000000000001);
+
+static bool validate_minimum_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_minimum_0_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#", json, json.to_number<double>(), validate_minimum_0_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_minimum_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_minimum_0_sub0(json, &e);
+}
+
+bool validate_minimum_0(const JsonValue& json)
+{
+    return validate_minimum_0_sub0(json, nullptr);
+}
+
+static bool validate_minimum_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_minimum_1_number0((i64)-2LL);
+
+static bool validate_minimum_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_minimum_1_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#", json, json.to_number<double>(), validate_minimum_1_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_minimum_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_minimum_1_sub0(json, &e);
+}
+
+bool validate_minimum_1(const JsonValue& json)
+{
+    return validate_minimum_1_sub0(json, nullptr);
+}
+
+static bool validate_multipleOf_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_multipleOf_0_number0((i64)2LL);
+
+static bool validate_multipleOf_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_multipleOf_0_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_multipleOf_0_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_multipleOf_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_multipleOf_0_sub0(json, &e);
+}
+
+bool validate_multipleOf_0(const JsonValue& json)
+{
+    return validate_multipleOf_0_sub0(json, nullptr);
+}
+
+static bool validate_multipleOf_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_multipleOf_1_number0(1.5);
+
+static bool validate_multipleOf_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_multipleOf_1_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_multipleOf_1_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_multipleOf_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_multipleOf_1_sub0(json, &e);
+}
+
+bool validate_multipleOf_1(const JsonValue& json)
+{
+    return validate_multipleOf_1_sub0(json, nullptr);
+}
+
+static bool validate_multipleOf_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_multipleOf_2_number0(0.0001);
+
+static bool validate_multipleOf_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_multipleOf_2_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_multipleOf_2_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_multipleOf_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_multipleOf_2_sub0(json, &e);
+}
+
+bool validate_multipleOf_2(const JsonValue& json)
+{
+    return validate_multipleOf_2_sub0(json, nullptr);
+}
+
+static bool validate_not_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_not_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_not_0_sub1(json, nullptr))
+        ++matches;
+    if (matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Not, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_not_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/not", json, 0, 32);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+bool validate_not_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_not_0_sub0(json, &e);
+}
+
+bool validate_not_0(const JsonValue& json)
+{
+    return validate_not_0_sub0(json, nullptr);
+}
+
+static bool validate_not_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_not_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_not_1_sub1(json, nullptr))
+        ++matches;
+    if (matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Not, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_not_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x22)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/not", json, 0, 34);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+bool validate_not_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_not_1_sub0(json, &e);
+}
+
+bool validate_not_1(const JsonValue& json)
+{
+    return validate_not_1_sub0(json, nullptr);
+}
+
+static bool validate_not_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_not_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_not_2_sub1(json, nullptr))
+        ++matches;
+    if (matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Not, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_not_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/not", json, 0, 4);
+        valid = false;
+        goto L6;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_not_2_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_not_2_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/not", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L6:
+    return valid;
+}
+
+static bool validate_not_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/not/properties/foo", json, 0, 16);
+        valid = false;
+        goto L9;
+    }
+L9:
+    return valid;
+}
+
+static bool validate_not_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_not_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_not_2_sub0(json, &e);
+}
+
+bool validate_not_2(const JsonValue& json)
+{
+    return validate_not_2_sub0(json, nullptr);
+}
+
+static bool validate_not_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_3_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_3_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_not_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_not_3_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_not_3_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_not_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_not_3_sub3(json, nullptr))
+        ++matches;
+    if (matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Not, "#/properties/foo", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_not_3_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_not_3_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_not_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_not_3_sub0(json, &e);
+}
+
+bool validate_not_3(const JsonValue& json)
+{
+    return validate_not_3_sub0(json, nullptr);
+}
+
+static bool validate_not_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_not_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_not_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_not_4_sub1(json, nullptr))
+        ++matches;
+    if (matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Not, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_not_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_not_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_not_4_sub0(json, &e);
+}
+
+bool validate_not_4(const JsonValue& json)
+{
+    return validate_not_4_sub0(json, nullptr);
+}
+
+static bool validate_not_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_not_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_not_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_not_5_sub0(json, &e);
+}
+
+bool validate_not_5(const JsonValue& json)
+{
+    return validate_not_5_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_oneOf_0_number0((i64)2LL);
+
+static bool validate_oneOf_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_0_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L4;
+    if (validate_oneOf_0_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/0", json, 0, 32);
+        valid = false;
+        goto L10;
+    }
+L10:
+    return valid;
+}
+
+static bool validate_oneOf_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L8;
+    if (validate_oneOf_0_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#/oneOf/1", json, json.to_number<double>(), validate_oneOf_0_number0.value());
+        valid = false;
+    }
+L8:
+    return valid;
+}
+
+bool validate_oneOf_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_0_sub0(json, &e);
+}
+
+bool validate_oneOf_0(const JsonValue& json)
+{
+    return validate_oneOf_0_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 16);
+        valid = false;
+        goto L6;
+    }
+    matches = 0;
+    if (validate_oneOf_1_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L5;
+    if (validate_oneOf_1_sub2(json, nullptr))
+        ++matches;
+L5:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_oneOf_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L12;
+    if (JsonValidator::below_min_length(json.as_string(), 2)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MinLength, "#/oneOf/0", json);
+        valid = false;
+    }
+L12:
+    return valid;
+}
+
+static bool validate_oneOf_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L9;
+    if (JsonValidator::exceeds_max_length(json.as_string(), 4)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxLength, "#/oneOf/1", json);
+        valid = false;
+    }
+L9:
+    return valid;
+}
+
+bool validate_oneOf_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_1_sub0(json, &e);
+}
+
+bool validate_oneOf_1(const JsonValue& json)
+{
+    return validate_oneOf_1_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_2_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L6;
+    if (validate_oneOf_2_sub2(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L6;
+    if (validate_oneOf_2_sub3(json, nullptr))
+        ++matches;
+L6:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_2_sub0(json, &e);
+}
+
+bool validate_oneOf_2(const JsonValue& json)
+{
+    return validate_oneOf_2_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_3_sub1(json, nullptr))
+        ++matches;
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_3_sub0(json, &e);
+}
+
+bool validate_oneOf_3(const JsonValue& json)
+{
+    return validate_oneOf_3_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_4_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_4_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L4;
+    if (validate_oneOf_4_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_4_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_4_sub0(json, &e);
+}
+
+bool validate_oneOf_4(const JsonValue& json)
+{
+    return validate_oneOf_4_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_5_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_5_sub1(json, nullptr))
+        ++matches;
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_5_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/oneOf/2", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_oneOf_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_5_sub0(json, &e);
+}
+
+bool validate_oneOf_5(const JsonValue& json)
+{
+    return validate_oneOf_5_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_6_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_6_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_6_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_6_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_6_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_6_sub6(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_6_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L4;
+    if (validate_oneOf_6_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_6_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L15;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x1u;
+                valid &= validate_oneOf_6_sub5(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_6_sub6(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L15:
+    return valid;
+}
+
+static bool validate_oneOf_6_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L8;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_oneOf_6_sub3(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_6_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "foo");
+        valid = false;
+    }
+    }
+    }
+L8:
+    return valid;
+}
+
+static bool validate_oneOf_6_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/1/properties/foo", json, 0, 16);
+        valid = false;
+        goto L12;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/1/properties/foo", json);
+        valid = false;
+        goto L12;
+    }
+L12:
+    return valid;
+}
+
+static bool validate_oneOf_6_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_6_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/0/properties/bar", json, 0, 32);
+        valid = false;
+        goto L19;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/0/properties/bar", json);
+        valid = false;
+        goto L19;
+    }
+L19:
+    return valid;
+}
+
+static bool validate_oneOf_6_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_6_sub0(json, &e);
+}
+
+bool validate_oneOf_6(const JsonValue& json)
+{
+    return validate_oneOf_6_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_7_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_7_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_7_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L4;
+    if (validate_oneOf_7_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_7_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/0", json, 0, 96);
+        valid = false;
+        goto L8;
+    }
+L8:
+    return valid;
+}
+
+static bool validate_oneOf_7_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_7_sub0(json, &e);
+}
+
+bool validate_oneOf_7(const JsonValue& json)
+{
+    return validate_oneOf_7_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_8_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_8_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_8_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_8_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_8_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_8_sub5(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_8_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 4);
+        valid = false;
+        goto L7;
+    }
+    matches = 0;
+    if (validate_oneOf_8_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L5;
+    if (validate_oneOf_8_sub2(json, nullptr))
+        ++matches;
+L5:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_8_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L7:
+    return valid;
+}
+
+static bool validate_oneOf_8_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L15;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x2u;
+                declared = false;
+                break;
+            }
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_8_sub5(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "foo");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L15:
+    return valid;
+}
+
+static bool validate_oneOf_8_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L11;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "baz") {
+                present[0] |= 0x2u;
+                declared = false;
+                break;
+            }
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_8_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "foo");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "baz");
+        valid = false;
+    }
+    }
+    }
+L11:
+    return valid;
+}
+
+static bool validate_oneOf_8_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_8_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_8_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_8(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_8_sub0(json, &e);
+}
+
+bool validate_oneOf_8(const JsonValue& json)
+{
+    return validate_oneOf_8_sub0(json, nullptr);
+}
+
+static bool validate_oneOf_9_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub6(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_oneOf_9_sub7(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_oneOf_9_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (validate_oneOf_9_sub1(json, nullptr))
+        ++matches;
+    if (matches >= 2)
+        goto L4;
+    if (validate_oneOf_9_sub2(json, nullptr))
+        ++matches;
+L4:
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_oneOf_9_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L13;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x1u;
+                valid &= validate_oneOf_9_sub6(value, e);
+                break;
+            }
+            if (key == "baz") {
+                present[0] |= 0x2u;
+                valid &= validate_oneOf_9_sub5(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_9_sub7(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "bar");
+        valid = false;
+    }
+    }
+    }
+L13:
+    return valid;
+}
+
+static bool validate_oneOf_9_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L8;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_oneOf_9_sub3(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_oneOf_9_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "foo");
+        valid = false;
+    }
+    }
+    }
+L8:
+    return valid;
+}
+
+static bool validate_oneOf_9_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_9_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_9_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_9_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_oneOf_9_sub7(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_oneOf_9(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_oneOf_9_sub0(json, &e);
+}
+
+bool validate_oneOf_9(const JsonValue& json)
+{
+    return validate_oneOf_9_sub0(json, nullptr);
+}
+
+static bool validate_date_time_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_date_time_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::DateTime, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 0);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_date_time_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_date_time_0_sub0(json, &e);
+}
+
+bool validate_date_time_0(const JsonValue& json)
+{
+    return validate_date_time_0_sub0(json, nullptr);
+}
+
+static bool validate_date_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_date_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Date, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 1);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_date_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_date_0_sub0(json, &e);
+}
+
+bool validate_date_0(const JsonValue& json)
+{
+    return validate_date_0_sub0(json, nullptr);
+}
+
+static bool validate_email_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_email_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Email, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 6);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_email_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_email_0_sub0(json, &e);
+}
+
+bool validate_email_0(const JsonValue& json)
+{
+    return validate_email_0_sub0(json, nullptr);
+}
+
+static bool validate_email_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_email_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_email_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Email, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 6);
+        valid = false;
+    }
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L3;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "a") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_email_1_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "a");
+        valid = false;
+    }
+    }
+    }
+L3:
+    return valid;
+}
+
+static bool validate_email_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_email_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_email_1_sub0(json, &e);
+}
+
+bool validate_email_1(const JsonValue& json)
+{
+    return validate_email_1_sub0(json, nullptr);
+}
+
+static bool validate_hostname_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_hostname_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Hostname, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 7);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_hostname_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_hostname_0_sub0(json, &e);
+}
+
+bool validate_hostname_0(const JsonValue& json)
+{
+    return validate_hostname_0_sub0(json, nullptr);
+}
+
+static bool validate_ipv4_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ipv4_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::IPv4, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 3);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_ipv4_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ipv4_0_sub0(json, &e);
+}
+
+bool validate_ipv4_0(const JsonValue& json)
+{
+    return validate_ipv4_0_sub0(json, nullptr);
+}
+
+static bool validate_ipv6_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ipv6_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::IPv6, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 4);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_ipv6_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ipv6_0_sub0(json, &e);
+}
+
+bool validate_ipv6_0(const JsonValue& json)
+{
+    return validate_ipv6_0_sub0(json, nullptr);
+}
+
+static bool validate_time_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_time_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::Time, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 2);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_time_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_time_0_sub0(json, &e);
+}
+
+bool validate_time_0(const JsonValue& json)
+{
+    return validate_time_0_sub0(json, nullptr);
+}
+
+static bool validate_uri_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_uri_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::URI, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 8);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_uri_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_uri_0_sub0(json, &e);
+}
+
+bool validate_uri_0(const JsonValue& json)
+{
+    return validate_uri_0_sub0(json, nullptr);
+}
+
+static bool validate_uuid_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_uuid_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_string() && !JsonValidator::matches_format(JsonValidator::Format::UUID, json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Format, "#", json, 0, 5);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_uuid_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_uuid_0_sub0(json, &e);
+}
+
+bool validate_uuid_0(const JsonValue& json)
+{
+    return validate_uuid_0_sub0(json, nullptr);
+}
+
+static bool validate_pattern_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::Pattern validate_pattern_0_pattern0("^a*$");
+
+static bool validate_pattern_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L2;
+    if (!validate_pattern_0_pattern0.matches(json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Pattern, "#", json);
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_pattern_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_pattern_0_sub0(json, &e);
+}
+
+bool validate_pattern_0(const JsonValue& json)
+{
+    return validate_pattern_0_sub0(json, nullptr);
+}
+
+static bool validate_pattern_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::Pattern validate_pattern_1_pattern0("a+");
+
+static bool validate_pattern_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L2;
+    if (!validate_pattern_1_pattern0.matches(json.as_string())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Pattern, "#", json);
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_pattern_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_pattern_1_sub0(json, &e);
+}
+
+bool validate_pattern_1(const JsonValue& json)
+{
+    return validate_pattern_1_sub0(json, nullptr);
+}
+
+static bool validate_patternProperties_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::RegexSet validate_patternProperties_0_patterns0 = [] {
+    Vector<String> patterns;
+    patterns.append("f.*o");
+    return JsonValidator::RegexSet(patterns);
+}();
+
+static bool validate_patternProperties_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            JsonValidator::RegexMatches matches;
+            validate_patternProperties_0_patterns0.search(key.characters(), key.length(), matches);
+            for (auto pattern : matches) {
+                match = true;
+                switch (pattern) {
+                case 0:
+                    valid &= validate_patternProperties_0_sub1(value, e);
+                    break;
+                }
+            }
+            if (!match) {
+                if (!validate_patternProperties_0_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_patternProperties_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/patternProperties/f.*o", json, 0, 32);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+static bool validate_patternProperties_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_patternProperties_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_patternProperties_0_sub0(json, &e);
+}
+
+bool validate_patternProperties_0(const JsonValue& json)
+{
+    return validate_patternProperties_0_sub0(json, nullptr);
+}
+
+static bool validate_patternProperties_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_1_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::RegexSet validate_patternProperties_1_patterns0 = [] {
+    Vector<String> patterns;
+    patterns.append("a*");
+    patterns.append("aaa*");
+    return JsonValidator::RegexSet(patterns);
+}();
+static const JsonValidator::NumberConstant validate_patternProperties_1_number1((i64)20LL);
+
+static bool validate_patternProperties_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            JsonValidator::RegexMatches matches;
+            validate_patternProperties_1_patterns0.search(key.characters(), key.length(), matches);
+            for (auto pattern : matches) {
+                match = true;
+                switch (pattern) {
+                case 0:
+                    valid &= validate_patternProperties_1_sub1(value, e);
+                    break;
+                case 1:
+                    valid &= validate_patternProperties_1_sub2(value, e);
+                    break;
+                }
+            }
+            if (!match) {
+                if (!validate_patternProperties_1_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_patternProperties_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/patternProperties/a*", json, 0, 32);
+        valid = false;
+        goto L8;
+    }
+L8:
+    return valid;
+}
+
+static bool validate_patternProperties_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L6;
+    if (validate_patternProperties_1_number1.compare(json) > 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Maximum, "#/patternProperties/aaa*", json, json.to_number<double>(), validate_patternProperties_1_number1.value());
+        valid = false;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_patternProperties_1_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_patternProperties_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_patternProperties_1_sub0(json, &e);
+}
+
+bool validate_patternProperties_1(const JsonValue& json)
+{
+    return validate_patternProperties_1_sub0(json, nullptr);
+}
+
+static bool validate_patternProperties_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::RegexSet validate_patternProperties_2_patterns0 = [] {
+    Vector<String> patterns;
+    patterns.append("[0-9]{2,}");
+    patterns.append("X_");
+    return JsonValidator::RegexSet(patterns);
+}();
+
+static bool validate_patternProperties_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            JsonValidator::RegexMatches matches;
+            validate_patternProperties_2_patterns0.search(key.characters(), key.length(), matches);
+            for (auto pattern : matches) {
+                match = true;
+                switch (pattern) {
+                case 0:
+                    valid &= validate_patternProperties_2_sub1(value, e);
+                    break;
+                case 1:
+                    valid &= validate_patternProperties_2_sub2(value, e);
+                    break;
+                }
+            }
+            if (!match) {
+                if (!validate_patternProperties_2_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_patternProperties_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/patternProperties/[0-9]{2,}", json, 0, 2);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+static bool validate_patternProperties_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/patternProperties/X_", json, 0, 16);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+static bool validate_patternProperties_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_patternProperties_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_patternProperties_2_sub0(json, &e);
+}
+
+bool validate_patternProperties_2(const JsonValue& json)
+{
+    return validate_patternProperties_2_sub0(json, nullptr);
+}
+
+static bool validate_patternProperties_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_3_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_patternProperties_3_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::RegexSet validate_patternProperties_3_patterns0 = [] {
+    Vector<String> patterns;
+    patterns.append("f.*");
+    patterns.append("b.*");
+    return JsonValidator::RegexSet(patterns);
+}();
+
+static bool validate_patternProperties_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            JsonValidator::RegexMatches matches;
+            validate_patternProperties_3_patterns0.search(key.characters(), key.length(), matches);
+            for (auto pattern : matches) {
+                match = true;
+                switch (pattern) {
+                case 0:
+                    valid &= validate_patternProperties_3_sub1(value, e);
+                    break;
+                case 1:
+                    valid &= validate_patternProperties_3_sub2(value, e);
+                    break;
+                }
+            }
+            if (!match) {
+                if (!validate_patternProperties_3_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_patternProperties_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_patternProperties_3_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/patternProperties/b.*", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_patternProperties_3_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_patternProperties_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_patternProperties_3_sub0(json, &e);
+}
+
+bool validate_patternProperties_3(const JsonValue& json)
+{
+    return validate_patternProperties_3_sub0(json, nullptr);
+}
+
+static bool validate_propertyNames_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_propertyNames_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_propertyNames_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_propertyNames_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_propertyNames_0_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+        if (!validate_propertyNames_0_sub2(JsonValue(key), e)) {
+            if (e)
+                e->add(JsonValidator::ValidationErrorKind::PropertyNames, "#", json);
+            valid = false;
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_propertyNames_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_propertyNames_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10))
+        goto L5;
+    if (JsonValidator::exceeds_max_length(json.as_string(), 3)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxLength, "#/propertyNames", json);
+        valid = false;
+    }
+L5:
+    return valid;
+}
+
+bool validate_propertyNames_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_propertyNames_0_sub0(json, &e);
+}
+
+bool validate_propertyNames_0(const JsonValue& json)
+{
+    return validate_propertyNames_0_sub0(json, nullptr);
+}
+
+static bool validate_propertyNames_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_propertyNames_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_propertyNames_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_propertyNames_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_propertyNames_1_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+        if (!validate_propertyNames_1_sub2(JsonValue(key), e)) {
+            if (e)
+                e->add(JsonValidator::ValidationErrorKind::PropertyNames, "#", json);
+            valid = false;
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_propertyNames_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_propertyNames_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_propertyNames_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_propertyNames_1_sub0(json, &e);
+}
+
+bool validate_propertyNames_1(const JsonValue& json)
+{
+    return validate_propertyNames_1_sub0(json, nullptr);
+}
+
+static bool validate_propertyNames_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_propertyNames_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_propertyNames_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_propertyNames_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_propertyNames_2_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+        if (!validate_propertyNames_2_sub2(JsonValue(key), e)) {
+            if (e)
+                e->add(JsonValidator::ValidationErrorKind::PropertyNames, "#", json);
+            valid = false;
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_propertyNames_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_propertyNames_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/propertyNames", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_propertyNames_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_propertyNames_2_sub0(json, &e);
+}
+
+bool validate_propertyNames_2(const JsonValue& json)
+{
+    return validate_propertyNames_2_sub0(json, nullptr);
+}
+
+static bool validate_ref_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_ref_0_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_0_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_0_sub0(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/additionalProperties", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_ref_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_0_sub0(json, &e);
+}
+
+bool validate_ref_0(const JsonValue& json)
+{
+    return validate_ref_0_sub0(json, nullptr);
+}
+
+static bool validate_ref_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_1_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                valid &= validate_ref_1_sub1(value, e);
+                break;
+            }
+            if (key == "foo") {
+                valid &= validate_ref_1_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_1_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_1_sub2(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/foo", json, 0, 32);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+static bool validate_ref_1_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_ref_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_1_sub0(json, &e);
+}
+
+bool validate_ref_1(const JsonValue& json)
+{
+    return validate_ref_1_sub0(json, nullptr);
+}
+
+static bool validate_ref_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_ref_2_sub1(values[0], e);
+        }
+        if (values.size() > 1) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)1);
+            valid &= validate_ref_2_sub2(values[1], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/0", json, 0, 32);
+        valid = false;
+        goto L6;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_ref_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_2_sub1(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+bool validate_ref_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_2_sub0(json, &e);
+}
+
+bool validate_ref_2(const JsonValue& json)
+{
+    return validate_ref_2_sub0(json, nullptr);
+}
+
+static bool validate_ref_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub6(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_3_sub7(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 5:
+            if (key == "slash") {
+                valid &= validate_ref_3_sub2(value, e);
+                break;
+            }
+            if (key == "tilda") {
+                valid &= validate_ref_3_sub3(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        case 7:
+            if (key == "percent") {
+                valid &= validate_ref_3_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_3_sub4(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_3_sub7(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_3_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_3_sub6(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_3_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_3_sub5(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_3_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_ref_3_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/tilda~0field", json, 0, 32);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+static bool validate_ref_3_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/slash~1field", json, 0, 32);
+        valid = false;
+        goto L11;
+    }
+L11:
+    return valid;
+}
+
+static bool validate_ref_3_sub7(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/percent%field", json, 0, 32);
+        valid = false;
+        goto L15;
+    }
+L15:
+    return valid;
+}
+
+bool validate_ref_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_3_sub0(json, &e);
+}
+
+bool validate_ref_3(const JsonValue& json)
+{
+    return validate_ref_3_sub0(json, nullptr);
+}
+
+static bool validate_ref_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_4_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_4_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_4_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_4_sub1(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_4_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_4_sub2(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_4_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_4_sub3(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_4_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/a", json, 0, 32);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+bool validate_ref_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_4_sub0(json, &e);
+}
+
+bool validate_ref_4(const JsonValue& json)
+{
+    return validate_ref_4_sub0(json, nullptr);
+}
+
+static bool validate_ref_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_5_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_5_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_5_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_ref_5_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_5_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_5_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_5_sub3(json, e);
+    if (!valid && !e)
+        return false;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L7;
+    if (json.as_array().values().size() > 2) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MaxItems, "#/properties/foo", json, json.as_array().values().size(), 2);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+static bool validate_ref_5_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_ref_5_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/reffed", json, 0, 8);
+        valid = false;
+        goto L9;
+    }
+L9:
+    return valid;
+}
+
+bool validate_ref_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_5_sub0(json, &e);
+}
+
+bool validate_ref_5(const JsonValue& json)
+{
+    return validate_ref_5_sub0(json, nullptr);
+}
+
+static bool validate_ref_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_6_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_6_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "$ref") {
+                valid &= validate_ref_6_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_6_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_6_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/$ref", json, 0, 16);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+static bool validate_ref_6_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_ref_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_6_sub0(json, &e);
+}
+
+bool validate_ref_6(const JsonValue& json)
+{
+    return validate_ref_6_sub0(json, nullptr);
+}
+
+static bool validate_ref_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_ref_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_7_sub0(json, &e);
+}
+
+bool validate_ref_7(const JsonValue& json)
+{
+    return validate_ref_7_sub0(json, nullptr);
+}
+
+static bool validate_ref_8_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_8_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_8_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_8_sub1(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_8_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/$defs/bool", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_ref_8(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_8_sub0(json, &e);
+}
+
+bool validate_ref_8(const JsonValue& json)
+{
+    return validate_ref_8_sub0(json, nullptr);
+}
+
+static bool validate_ref_9_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub6(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub7(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_9_sub8(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_9_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 4);
+        valid = false;
+        goto L2;
+    }
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "meta") {
+                present[0] |= 0x2u;
+                valid &= validate_ref_9_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        case 5:
+            if (key == "nodes") {
+                present[0] |= 0x1u;
+                valid &= validate_ref_9_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_9_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "nodes");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "meta");
+        valid = false;
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_ref_9_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/nodes", json, 0, 8);
+        valid = false;
+        goto L10;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/properties/nodes", json);
+        valid = false;
+        goto L10;
+    }
+    {
+        auto& values = json.as_array().values();
+        for (size_t i = 0; i < values.size(); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            if (!validate_ref_9_sub4(values[i], e)) {
+                if (!e)
+                    return false;
+                valid = false;
+            }
+        }
+    }
+L10:
+    return valid;
+}
+
+static bool validate_ref_9_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/properties/meta", json, 0, 16);
+        valid = false;
+        goto L6;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/properties/meta", json);
+        valid = false;
+        goto L6;
+    }
+L6:
+    return valid;
+}
+
+static bool validate_ref_9_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_ref_9_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_9_sub5(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_9_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/node", json, 0, 4);
+        valid = false;
+        goto L15;
+    }
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 5:
+            if (key == "value") {
+                present[0] |= 0x2u;
+                valid &= validate_ref_9_sub7(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        case 7:
+            if (key == "subtree") {
+                present[0] |= 0x1u;
+                valid &= validate_ref_9_sub6(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_9_sub8(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/$defs/node", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x2u) != 0x2u) {
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/$defs/node", json, "value");
+        valid = false;
+    }
+    }
+    }
+L15:
+    return valid;
+}
+
+static bool validate_ref_9_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_9_sub0(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_9_sub7(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/node/properties/value", json, 0, 96);
+        valid = false;
+        goto L19;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/$defs/node/properties/value", json);
+        valid = false;
+        goto L19;
+    }
+L19:
+    return valid;
+}
+
+static bool validate_ref_9_sub8(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_ref_9(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_9_sub0(json, &e);
+}
+
+bool validate_ref_9(const JsonValue& json)
+{
+    return validate_ref_9_sub0(json, nullptr);
+}
+
+static bool validate_ref_10_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_10_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_10_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_ref_10_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_ref_10_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 7:
+            if (key == "foo\"bar") {
+                valid &= validate_ref_10_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_ref_10_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_ref_10_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    valid &= validate_ref_10_sub3(json, e);
+    if (!valid && !e)
+        return false;
+    return valid;
+}
+
+static bool validate_ref_10_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_ref_10_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/$defs/foo\"bar", json, 0, 96);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+bool validate_ref_10(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_ref_10_sub0(json, &e);
+}
+
+bool validate_ref_10(const JsonValue& json)
+{
+    return validate_ref_10_sub0(json, nullptr);
+}
+
+static bool validate_required_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_0_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_required_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "bar") {
+                present[0] |= 0x2u;
+                valid &= validate_required_0_sub1(value, e);
+                break;
+            }
+            if (key == "foo") {
+                present[0] |= 0x1u;
+                valid &= validate_required_0_sub2(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_required_0_sub3(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo");
+        valid = false;
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_required_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_required_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_required_0_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_required_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_required_0_sub0(json, &e);
+}
+
+bool validate_required_0(const JsonValue& json)
+{
+    return validate_required_0_sub0(json, nullptr);
+}
+
+static bool validate_required_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_required_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_required_1_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_required_1_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_required_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_required_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_required_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_required_1_sub0(json, &e);
+}
+
+bool validate_required_1(const JsonValue& json)
+{
+    return validate_required_1_sub0(json, nullptr);
+}
+
+static bool validate_required_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_required_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 3:
+            if (key == "foo") {
+                valid &= validate_required_2_sub1(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_required_2_sub2(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_required_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_required_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_required_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_required_2_sub0(json, &e);
+}
+
+bool validate_required_2(const JsonValue& json)
+{
+    return validate_required_2_sub0(json, nullptr);
+}
+
+static bool validate_required_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_required_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_required_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L2;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 7:
+            if (key == "foo\011bar") {
+                present[0] |= 0x8u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\012bar") {
+                present[0] |= 0x10u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\014bar") {
+                present[0] |= 0x4u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\015bar") {
+                present[0] |= 0x2u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\"bar") {
+                present[0] |= 0x20u;
+                declared = false;
+                break;
+            }
+            if (key == "foo\\bar") {
+                present[0] |= 0x1u;
+                declared = false;
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_required_3_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3fu) != 0x3fu) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo\\bar");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo\015bar");
+        valid = false;
+    }
+    if (!(present[0] & 0x4u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo\014bar");
+        valid = false;
+    }
+    if (!(present[0] & 0x8u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo\011bar");
+        valid = false;
+    }
+    if (!(present[0] & 0x10u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo\012bar");
+        valid = false;
+    }
+    if (!(present[0] & 0x20u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#", json, "foo\"bar");
+        valid = false;
+    }
+    }
+    }
+L2:
+    return valid;
+}
+
+static bool validate_required_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_required_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_required_3_sub0(json, &e);
+}
+
+bool validate_required_3(const JsonValue& json)
+{
+    return validate_required_3_sub0(json, nullptr);
+}
+
+static bool validate_type_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 32);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_0_sub0(json, &e);
+}
+
+bool validate_type_0(const JsonValue& json)
+{
+    return validate_type_0_sub0(json, nullptr);
+}
+
+static bool validate_type_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 96);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_1_sub0(json, &e);
+}
+
+bool validate_type_1(const JsonValue& json)
+{
+    return validate_type_1_sub0(json, nullptr);
+}
+
+static bool validate_type_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 16);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_2_sub0(json, &e);
+}
+
+bool validate_type_2(const JsonValue& json)
+{
+    return validate_type_2_sub0(json, nullptr);
+}
+
+static bool validate_type_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_type_3_sub1(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 4);
+        valid = false;
+        goto L2;
+    }
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_type_3_sub1(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+L2:
+    return valid;
+}
+
+static bool validate_type_3_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_type_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_3_sub0(json, &e);
+}
+
+bool validate_type_3(const JsonValue& json)
+{
+    return validate_type_3_sub0(json, nullptr);
+}
+
+static bool validate_type_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 8);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_4_sub0(json, &e);
+}
+
+bool validate_type_4(const JsonValue& json)
+{
+    return validate_type_4_sub0(json, nullptr);
+}
+
+static bool validate_type_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 2);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_5_sub0(json, &e);
+}
+
+bool validate_type_5(const JsonValue& json)
+{
+    return validate_type_5_sub0(json, nullptr);
+}
+
+static bool validate_type_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x01)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 1);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_6_sub0(json, &e);
+}
+
+bool validate_type_6(const JsonValue& json)
+{
+    return validate_type_6_sub0(json, nullptr);
+}
+
+static bool validate_type_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x30)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 48);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_7_sub0(json, &e);
+}
+
+bool validate_type_7(const JsonValue& json)
+{
+    return validate_type_7_sub0(json, nullptr);
+}
+
+static bool validate_type_8_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_8_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x10)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 16);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_8(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_8_sub0(json, &e);
+}
+
+bool validate_type_8(const JsonValue& json)
+{
+    return validate_type_8_sub0(json, nullptr);
+}
+
+static bool validate_type_9_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_9_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x0c)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 12);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_9(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_9_sub0(json, &e);
+}
+
+bool validate_type_9(const JsonValue& json)
+{
+    return validate_type_9_sub0(json, nullptr);
+}
+
+static bool validate_type_10_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_type_10_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x0d)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#", json, 0, 13);
+        valid = false;
+        goto L1;
+    }
+L1:
+    return valid;
+}
+
+bool validate_type_10(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_type_10_sub0(json, &e);
+}
+
+bool validate_type_10(const JsonValue& json)
+{
+    return validate_type_10_sub0(json, nullptr);
+}
+
+static bool validate_uniqueItems_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_uniqueItems_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L2;
+    if (auto* duplicate = JsonValidator::find_duplicate_item(json.as_array())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::UniqueItems, "#", json, JsonValidator::excerpt(*duplicate));
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_uniqueItems_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_uniqueItems_0_sub0(json, &e);
+}
+
+bool validate_uniqueItems_0(const JsonValue& json)
+{
+    return validate_uniqueItems_0_sub0(json, nullptr);
+}
+
+static bool validate_uniqueItems_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_uniqueItems_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_uniqueItems_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_uniqueItems_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L3;
+    if (auto* duplicate = JsonValidator::find_duplicate_item(json.as_array())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::UniqueItems, "#", json, JsonValidator::excerpt(*duplicate));
+        valid = false;
+    }
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_uniqueItems_1_sub1(values[0], e);
+        }
+        if (values.size() > 1) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)1);
+            valid &= validate_uniqueItems_1_sub2(values[1], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L3:
+    return valid;
+}
+
+static bool validate_uniqueItems_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/0", json, 0, 2);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+static bool validate_uniqueItems_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/1", json, 0, 2);
+        valid = false;
+        goto L5;
+    }
+L5:
+    return valid;
+}
+
+bool validate_uniqueItems_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_uniqueItems_1_sub0(json, &e);
+}
+
+bool validate_uniqueItems_1(const JsonValue& json)
+{
+    return validate_uniqueItems_1_sub0(json, nullptr);
+}
+
+static bool validate_uniqueItems_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_uniqueItems_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_uniqueItems_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_uniqueItems_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+
+static bool validate_uniqueItems_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x08))
+        goto L3;
+    if (auto* duplicate = JsonValidator::find_duplicate_item(json.as_array())) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::UniqueItems, "#", json, JsonValidator::excerpt(*duplicate));
+        valid = false;
+    }
+    {
+        auto& values = json.as_array().values();
+        if (values.size() > 0) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)0);
+            valid &= validate_uniqueItems_2_sub1(values[0], e);
+        }
+        if (values.size() > 1) {
+            JsonValidator::InstanceLocationScope scope(e, (size_t)1);
+            valid &= validate_uniqueItems_2_sub2(values[1], e);
+        }
+        for (size_t i = 2; i < values.size() && (valid || e); ++i) {
+            JsonValidator::InstanceLocationScope scope(e, i);
+            valid &= validate_uniqueItems_2_sub3(values[i], e);
+        }
+    }
+    if (!valid && !e)
+        return false;
+L3:
+    return valid;
+}
+
+static bool validate_uniqueItems_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/0", json, 0, 2);
+        valid = false;
+        goto L9;
+    }
+L9:
+    return valid;
+}
+
+static bool validate_uniqueItems_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x02)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/items/1", json, 0, 2);
+        valid = false;
+        goto L7;
+    }
+L7:
+    return valid;
+}
+
+static bool validate_uniqueItems_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::FalseSchema, "#/additionalItems", json);
+        valid = false;
+    }
+    return valid;
+}
+
+bool validate_uniqueItems_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_uniqueItems_2_sub0(json, &e);
+}
+
+bool validate_uniqueItems_2(const JsonValue& json)
+{
+    return validate_uniqueItems_2_sub0(json, nullptr);
+}
+
+static bool validate_numbers_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_0_number0(2.5);
+
+static bool validate_numbers_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_numbers_0_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_numbers_0_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_0_sub0(json, &e);
+}
+
+bool validate_numbers_0(const JsonValue& json)
+{
+    return validate_numbers_0_sub0(json, nullptr);
+}
+
+static bool validate_numbers_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_1_number0(0.01);
+
+static bool validate_numbers_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_numbers_1_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_numbers_1_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_1_sub0(json, &e);
+}
+
+bool validate_numbers_1(const JsonValue& json)
+{
+    return validate_numbers_1_sub0(json, nullptr);
+}
+
+static bool validate_numbers_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_2_number0((i64)9007199254740993LL);
+
+static bool validate_numbers_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_numbers_2_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#", json, json.to_number<double>(), validate_numbers_2_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_2_sub0(json, &e);
+}
+
+bool validate_numbers_2(const JsonValue& json)
+{
+    return validate_numbers_2_sub0(json, nullptr);
+}
+
+static bool validate_numbers_3_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_3_number0((i64)9007199254740993LL);
+
+static bool validate_numbers_3_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_numbers_3_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_numbers_3_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_3(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_3_sub0(json, &e);
+}
+
+bool validate_numbers_3(const JsonValue& json)
+{
+    return validate_numbers_3_sub0(json, nullptr);
+}
+
+static bool validate_numbers_4_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_4_number0((i64)9223372036854775807LL);
+
+static bool validate_numbers_4_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_numbers_4_number0.compare(json) > 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Maximum, "#", json, json.to_number<double>(), validate_numbers_4_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_4(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_4_sub0(json, &e);
+}
+
+bool validate_numbers_4(const JsonValue& json)
+{
+    return validate_numbers_4_sub0(json, nullptr);
+}
+
+static bool validate_numbers_5_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_5_number0((u64)9223372036854775808ULL);
+
+static bool validate_numbers_5_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_numbers_5_number0.compare(json) < 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Minimum, "#", json, json.to_number<double>(), validate_numbers_5_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_5(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_5_sub0(json, &e);
+}
+
+bool validate_numbers_5(const JsonValue& json)
+{
+    return validate_numbers_5_sub0(json, nullptr);
+}
+
+static bool validate_numbers_6_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_6_number0((u64)18446744073709551615ULL);
+
+static bool validate_numbers_6_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (validate_numbers_6_number0.compare(json) >= 0) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::ExclusiveMaximum, "#", json, json.to_number<double>(), validate_numbers_6_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_6(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_6_sub0(json, &e);
+}
+
+bool validate_numbers_6(const JsonValue& json)
+{
+    return validate_numbers_6_sub0(json, nullptr);
+}
+
+static bool validate_numbers_7_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::NumberConstant validate_numbers_7_number0((i64)3LL);
+
+static bool validate_numbers_7_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x60))
+        goto L2;
+    if (!validate_numbers_7_number0.divides(json)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::MultipleOf, "#", json, json.to_number<double>(), validate_numbers_7_number0.value());
+        valid = false;
+    }
+L2:
+    return valid;
+}
+
+bool validate_numbers_7(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_numbers_7_sub0(json, &e);
+}
+
+bool validate_numbers_7(const JsonValue& json)
+{
+    return validate_numbers_7_sub0(json, nullptr);
+}
+
+static bool validate_tagged_unions_0_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub6(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub7(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub8(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub9(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub10(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub11(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_0_sub12(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::EnumSet validate_tagged_unions_0_tags0(JsonValue::from_string("[\"a\",\"b\",\"c\"]").as_array());
+
+static bool validate_tagged_unions_0_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (json.is_object()) {
+        auto* tag_value = json.as_object().get_ptr("kind");
+        auto tag = tag_value ? validate_tagged_unions_0_tags0.find(*tag_value) : Optional<u32> {};
+        if (tag.has_value()) {
+            switch (tag.value()) {
+            case 0:
+                if (matches < 2 && validate_tagged_unions_0_sub1(json, nullptr))
+                    ++matches;
+                break;
+            case 1:
+                if (matches < 2 && validate_tagged_unions_0_sub2(json, nullptr))
+                    ++matches;
+                break;
+            case 2:
+                if (matches < 2 && validate_tagged_unions_0_sub2(json, nullptr))
+                    ++matches;
+                if (matches < 2 && validate_tagged_unions_0_sub3(json, nullptr))
+                    ++matches;
+                break;
+            }
+        }
+    } else {
+        if (matches < 2 && validate_tagged_unions_0_sub1(json, nullptr))
+            ++matches;
+        if (matches < 2 && validate_tagged_unions_0_sub2(json, nullptr))
+            ++matches;
+        if (matches < 2 && validate_tagged_unions_0_sub3(json, nullptr))
+            ++matches;
+    }
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L26;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "kind") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_0_sub11(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        case 6:
+            if (key == "radius") {
+                present[0] |= 0x2u;
+                valid &= validate_tagged_unions_0_sub10(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_0_sub12(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "kind");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "radius");
+        valid = false;
+    }
+    }
+    }
+L26:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L16;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "kind") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_0_sub8(value, e);
+                break;
+            }
+            if (key == "size") {
+                present[0] |= 0x2u;
+                valid &= validate_tagged_unions_0_sub7(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_0_sub9(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "kind");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "size");
+        valid = false;
+    }
+    }
+    }
+L16:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L6;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "kind") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_0_sub5(value, e);
+                break;
+            }
+            if (key == "side") {
+                present[0] |= 0x2u;
+                valid &= validate_tagged_unions_0_sub4(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_0_sub6(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/2", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/2", json, "kind");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/2", json, "side");
+        valid = false;
+    }
+    }
+    }
+L6:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/2/properties/side", json, 0, 32);
+        valid = false;
+        goto L13;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/2/properties/side", json);
+        valid = false;
+        goto L13;
+    }
+L13:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/2/properties/kind", json);
+        valid = false;
+        goto L10;
+    }
+    if (!((json.is_string() && json.as_string() == "c"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/oneOf/2/properties/kind", json);
+        valid = false;
+    }
+L10:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub7(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/1/properties/size", json, 0, 32);
+        valid = false;
+        goto L23;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/1/properties/size", json);
+        valid = false;
+        goto L23;
+    }
+L23:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub8(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/1/properties/kind", json);
+        valid = false;
+        goto L20;
+    }
+    if (!((json.is_string() && json.as_string() == "b")
+        || (json.is_string() && json.as_string() == "c"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/oneOf/1/properties/kind", json);
+        valid = false;
+    }
+L20:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub9(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub10(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/0/properties/radius", json, 0, 32);
+        valid = false;
+        goto L33;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/0/properties/radius", json);
+        valid = false;
+        goto L33;
+    }
+L33:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub11(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/0/properties/kind", json);
+        valid = false;
+        goto L30;
+    }
+    if (!((json.is_string() && json.as_string() == "a"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/oneOf/0/properties/kind", json);
+        valid = false;
+    }
+L30:
+    return valid;
+}
+
+static bool validate_tagged_unions_0_sub12(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_tagged_unions_0(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_tagged_unions_0_sub0(json, &e);
+}
+
+bool validate_tagged_unions_0(const JsonValue& json)
+{
+    return validate_tagged_unions_0_sub0(json, nullptr);
+}
+
+static bool validate_tagged_unions_1_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub6(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub7(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub8(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub9(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub10(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub11(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_1_sub12(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::EnumSet validate_tagged_unions_1_tags0(JsonValue::from_string("[1,2,3]").as_array());
+
+static bool validate_tagged_unions_1_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (json.is_object()) {
+        auto* tag_value = json.as_object().get_ptr("t");
+        auto tag = tag_value ? validate_tagged_unions_1_tags0.find(*tag_value) : Optional<u32> {};
+        if (tag.has_value()) {
+            switch (tag.value()) {
+            case 0:
+                if (matches < 1 && validate_tagged_unions_1_sub1(json, nullptr))
+                    ++matches;
+                break;
+            case 1:
+                if (matches < 1 && validate_tagged_unions_1_sub2(json, nullptr))
+                    ++matches;
+                break;
+            case 2:
+                if (matches < 1 && validate_tagged_unions_1_sub3(json, nullptr))
+                    ++matches;
+                break;
+            }
+        }
+    } else {
+        if (matches < 1 && validate_tagged_unions_1_sub1(json, nullptr))
+            ++matches;
+        if (matches < 1 && validate_tagged_unions_1_sub2(json, nullptr))
+            ++matches;
+        if (matches < 1 && validate_tagged_unions_1_sub3(json, nullptr))
+            ++matches;
+    }
+    if (!matches) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::AnyOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L26;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "a") {
+                present[0] |= 0x2u;
+                valid &= validate_tagged_unions_1_sub10(value, e);
+                break;
+            }
+            if (key == "t") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_1_sub11(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_1_sub12(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/anyOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/0", json, "t");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/0", json, "a");
+        valid = false;
+    }
+    }
+    }
+L26:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L16;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "b") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_1_sub7(value, e);
+                break;
+            }
+            if (key == "t") {
+                present[0] |= 0x2u;
+                valid &= validate_tagged_unions_1_sub8(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_1_sub9(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/anyOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/1", json, "b");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/1", json, "t");
+        valid = false;
+    }
+    }
+    }
+L16:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L6;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "c") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_1_sub4(value, e);
+                break;
+            }
+            if (key == "t") {
+                present[0] |= 0x2u;
+                valid &= validate_tagged_unions_1_sub5(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_1_sub6(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/anyOf/2", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x3u) != 0x3u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/2", json, "c");
+        valid = false;
+    }
+    if (!(present[0] & 0x2u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/anyOf/2", json, "t");
+        valid = false;
+    }
+    }
+    }
+L6:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/2/properties/c", json, 0, 32);
+        valid = false;
+        goto L13;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/2/properties/c", json);
+        valid = false;
+        goto L13;
+    }
+L13:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/2/properties/t", json);
+        valid = false;
+        goto L10;
+    }
+    if (!((json.is_number() && json.to_number<double>() == 3.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/anyOf/2/properties/t", json);
+        valid = false;
+    }
+L10:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub7(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/1/properties/b", json, 0, 32);
+        valid = false;
+        goto L23;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/1/properties/b", json);
+        valid = false;
+        goto L23;
+    }
+L23:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub8(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/1/properties/t", json);
+        valid = false;
+        goto L20;
+    }
+    if (!((json.is_number() && json.to_number<double>() == 2.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/anyOf/1/properties/t", json);
+        valid = false;
+    }
+L20:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub9(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub10(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/anyOf/0/properties/a", json, 0, 32);
+        valid = false;
+        goto L33;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/0/properties/a", json);
+        valid = false;
+        goto L33;
+    }
+L33:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub11(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/anyOf/0/properties/t", json);
+        valid = false;
+        goto L30;
+    }
+    if (!((json.is_number() && json.to_number<double>() == 1.0))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/anyOf/0/properties/t", json);
+        valid = false;
+    }
+L30:
+    return valid;
+}
+
+static bool validate_tagged_unions_1_sub12(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_tagged_unions_1(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_tagged_unions_1_sub0(json, &e);
+}
+
+bool validate_tagged_unions_1(const JsonValue& json)
+{
+    return validate_tagged_unions_1_sub0(json, nullptr);
+}
+
+static bool validate_tagged_unions_2_sub0(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub1(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub2(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub3(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub4(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub5(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub6(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub7(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub8(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub9(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub10(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub11(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub12(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub13(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub14(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub15(const JsonValue&, JsonValidator::ValidationError*);
+static bool validate_tagged_unions_2_sub16(const JsonValue&, JsonValidator::ValidationError*);
+static const JsonValidator::EnumSet validate_tagged_unions_2_tags0(JsonValue::from_string("[\"a\",\"b\",\"c\"]").as_array());
+
+static bool validate_tagged_unions_2_sub0(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    u32 matches = 0;
+    matches = 0;
+    if (json.is_object()) {
+        auto* tag_value = json.as_object().get_ptr("kind");
+        auto tag = tag_value ? validate_tagged_unions_2_tags0.find(*tag_value) : Optional<u32> {};
+        if (tag.has_value()) {
+            switch (tag.value()) {
+            case 0:
+                if (matches < 2 && validate_tagged_unions_2_sub1(json, nullptr))
+                    ++matches;
+                break;
+            case 1:
+                if (matches < 2 && validate_tagged_unions_2_sub2(json, nullptr))
+                    ++matches;
+                break;
+            case 2:
+                if (matches < 2 && validate_tagged_unions_2_sub3(json, nullptr))
+                    ++matches;
+                break;
+            }
+        }
+    } else {
+        if (matches < 2 && validate_tagged_unions_2_sub1(json, nullptr))
+            ++matches;
+        if (matches < 2 && validate_tagged_unions_2_sub2(json, nullptr))
+            ++matches;
+        if (matches < 2 && validate_tagged_unions_2_sub3(json, nullptr))
+            ++matches;
+    }
+    if (matches != 1) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::OneOf, "#", json);
+        valid = false;
+    }
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub1(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/0", json, 0, 4);
+        valid = false;
+        goto L36;
+    }
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L35;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "kind") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_2_sub13(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_2_sub14(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "kind");
+        valid = false;
+    }
+    }
+    }
+L35:
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "a") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_2_sub15(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_2_sub16(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/0", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/0", json, "a");
+        valid = false;
+    }
+    }
+    }
+L36:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub2(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/1", json, 0, 4);
+        valid = false;
+        goto L23;
+    }
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L22;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "kind") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_2_sub9(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_2_sub10(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "kind");
+        valid = false;
+    }
+    }
+    }
+L22:
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "b") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_2_sub11(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_2_sub12(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/1", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/1", json, "b");
+        valid = false;
+    }
+    }
+    }
+L23:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub3(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/2", json, 0, 4);
+        valid = false;
+        goto L7;
+    }
+    valid &= validate_tagged_unions_2_sub4(json, e);
+    if (!valid && !e)
+        return false;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 1:
+            if (key == "c") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_2_sub5(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_2_sub6(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/oneOf/2", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/oneOf/2", json, "c");
+        valid = false;
+    }
+    }
+    }
+L7:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub4(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x04))
+        goto L14;
+    {
+    u32 present[1] = {};
+    json.as_object().for_each_member([&](auto& key, auto& value) {
+        (void)value;
+        if (!valid && !e)
+            return;
+        JsonValidator::InstanceLocationScope scope(e, key);
+        bool declared = true;
+        switch (key.length()) {
+        case 4:
+            if (key == "kind") {
+                present[0] |= 0x1u;
+                valid &= validate_tagged_unions_2_sub7(value, e);
+                break;
+            }
+            declared = false;
+            break;
+        default:
+            declared = false;
+        }
+        if (!declared) {
+            bool match = false;
+            if (!match) {
+                if (!validate_tagged_unions_2_sub8(value, e)) {
+                    if (e)
+                        e->add(JsonValidator::ValidationErrorKind::AdditionalProperty, "#/$defs/c", json);
+                    valid = false;
+                }
+            }
+        }
+    });
+    if (!valid && !e)
+        return false;
+    if ((present[0] & 0x1u) != 0x1u) {
+    if (!(present[0] & 0x1u)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Required, "#/$defs/c", json, "kind");
+        valid = false;
+    }
+    }
+    }
+L14:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub5(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/2/properties/c", json, 0, 32);
+        valid = false;
+        goto L11;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/2/properties/c", json);
+        valid = false;
+        goto L11;
+    }
+L11:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub6(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub7(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/$defs/c/properties/kind", json);
+        valid = false;
+        goto L18;
+    }
+    if (!((json.is_string() && json.as_string() == "c"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/$defs/c/properties/kind", json);
+        valid = false;
+    }
+L18:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub8(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub9(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/1/allOf/0/properties/kind", json);
+        valid = false;
+        goto L31;
+    }
+    if (!((json.is_string() && json.as_string() == "b"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/oneOf/1/allOf/0/properties/kind", json);
+        valid = false;
+    }
+L31:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub10(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub11(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/1/properties/b", json, 0, 32);
+        valid = false;
+        goto L27;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/1/properties/b", json);
+        valid = false;
+        goto L27;
+    }
+L27:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub12(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub13(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/0/allOf/0/properties/kind", json);
+        valid = false;
+        goto L44;
+    }
+    if (!((json.is_string() && json.as_string() == "a"))) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Enum, "#/oneOf/0/allOf/0/properties/kind", json);
+        valid = false;
+    }
+L44:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub14(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub15(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    if (!(JsonValidator::type_mask_of(json) & 0x20)) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::Type, "#/oneOf/0/properties/a", json, 0, 32);
+        valid = false;
+        goto L40;
+    }
+    if (json.is_undefined()) {
+        if (!e)
+            return false;
+        e->add(JsonValidator::ValidationErrorKind::NotPresent, "#/oneOf/0/properties/a", json);
+        valid = false;
+        goto L40;
+    }
+L40:
+    return valid;
+}
+
+static bool validate_tagged_unions_2_sub16(const JsonValue& json, JsonValidator::ValidationError* e)
+{
+    (void)json;
+    (void)e;
+    bool valid = true;
+    return valid;
+}
+
+bool validate_tagged_unions_2(const JsonValue& json, JsonValidator::ValidationError& e)
+{
+    return validate_tagged_unions_2_sub0(json, &e);
+}
+
+bool validate_tagged_unions_2(const JsonValue& json)
+{
+    return validate_tagged_unions_2_sub0(json, nullptr);
+}
+
+const GeneratedValidator generated_validators[] = {
+    { "additionalItems", 0, validate_additionalItems_0, validate_additionalItems_0 },
+    { "additionalItems", 1, validate_additionalItems_1, validate_additionalItems_1 },
+    { "additionalItems", 2, validate_additionalItems_2, validate_additionalItems_2 },
+    { "additionalItems", 3, validate_additionalItems_3, validate_additionalItems_3 },
+    { "additionalItems", 4, validate_additionalItems_4, validate_additionalItems_4 },
+    { "additionalProperties", 0, validate_additionalProperties_0, validate_additionalProperties_0 },
+    { "additionalProperties", 1, validate_additionalProperties_1, validate_additionalProperties_1 },
+    { "additionalProperties", 2, validate_additionalProperties_2, validate_additionalProperties_2 },
+    { "additionalProperties", 3, validate_additionalProperties_3, validate_additionalProperties_3 },
+    { "additionalProperties", 4, validate_additionalProperties_4, validate_additionalProperties_4 },
+    { "additionalProperties", 5, validate_additionalProperties_5, validate_additionalProperties_5 },
+    { "allOf", 0, validate_allOf_0, validate_allOf_0 },
+    { "allOf", 1, validate_allOf_1, validate_allOf_1 },
+    { "allOf", 2, validate_allOf_2, validate_allOf_2 },
+    { "allOf", 3, validate_allOf_3, validate_allOf_3 },
+    { "allOf", 4, validate_allOf_4, validate_allOf_4 },
+    { "allOf", 5, validate_allOf_5, validate_allOf_5 },
+    { "allOf", 6, validate_allOf_6, validate_allOf_6 },
+    { "allOf", 7, validate_allOf_7, validate_allOf_7 },
+    { "allOf", 8, validate_allOf_8, validate_allOf_8 },
+    { "allOf", 9, validate_allOf_9, validate_allOf_9 },
+    { "anchor", 0, validate_anchor_0, validate_anchor_0 },
+    { "anyOf", 0, validate_anyOf_0, validate_anyOf_0 },
+    { "anyOf", 1, validate_anyOf_1, validate_anyOf_1 },
+    { "anyOf", 2, validate_anyOf_2, validate_anyOf_2 },
+    { "anyOf", 3, validate_anyOf_3, validate_anyOf_3 },
+    { "anyOf", 4, validate_anyOf_4, validate_anyOf_4 },
+    { "anyOf", 5, validate_anyOf_5, validate_anyOf_5 },
+    { "anyOf", 6, validate_anyOf_6, validate_anyOf_6 },
+    { "anyOf", 7, validate_anyOf_7, validate_anyOf_7 },
+    { "boolean_schema", 0, validate_boolean_schema_0, validate_boolean_schema_0 },
+    { "boolean_schema", 1, validate_boolean_schema_1, validate_boolean_schema_1 },
+    { "const", 0, validate_const_0, validate_const_0 },
+    { "const", 1, validate_const_1, validate_const_1 },
+    { "const", 2, validate_const_2, validate_const_2 },
+    { "const", 3, validate_const_3, validate_const_3 },
+    { "const", 4, validate_const_4, validate_const_4 },
+    { "const", 5, validate_const_5, validate_const_5 },
+    { "const", 6, validate_const_6, validate_const_6 },
+    { "const", 7, validate_const_7, validate_const_7 },
+    { "const", 8, validate_const_8, validate_const_8 },
+    { "const", 9, validate_const_9, validate_const_9 },
+    { "contains", 0, validate_contains_0, validate_contains_0 },
+    { "contains", 1, validate_contains_1, validate_contains_1 },
+    { "contains", 2, validate_contains_2, validate_contains_2 },
+    { "contains", 3, validate_contains_3, validate_contains_3 },
+    { "default", 0, validate_default_0, validate_default_0 },
+    { "default", 1, validate_default_1, validate_default_1 },
+    { "defs", 0, validate_defs_0, validate_defs_0 },
+    { "defs", 1, validate_defs_1, validate_defs_1 },
+    { "dependentRequired", 0, validate_dependentRequired_0, validate_dependentRequired_0 },
+    { "dependentRequired", 1, validate_dependentRequired_1, validate_dependentRequired_1 },
+    { "dependentRequired", 2, validate_dependentRequired_2, validate_dependentRequired_2 },
+    { "dependentRequired", 3, validate_dependentRequired_3, validate_dependentRequired_3 },
+    { "dependentSchemas", 0, validate_dependentSchemas_0, validate_dependentSchemas_0 },
+    { "dependentSchemas", 1, validate_dependentSchemas_1, validate_dependentSchemas_1 },
+    { "dependentSchemas", 2, validate_dependentSchemas_2, validate_dependentSchemas_2 },
+    { "enum", 0, validate_enum_0, validate_enum_0 },
+    { "enum", 1, validate_enum_1, validate_enum_1 },
+    { "enum", 2, validate_enum_2, validate_enum_2 },
+    { "enum", 3, validate_enum_3, validate_enum_3 },
+    { "enum", 4, validate_enum_4, validate_enum_4 },
+    { "enum", 5, validate_enum_5, validate_enum_5 },
+    { "enum", 6, validate_enum_6, validate_enum_6 },
+    { "enum", 7, validate_enum_7, validate_enum_7 },
+    { "exclusiveMaximum", 0, validate_exclusiveMaximum_0, validate_exclusiveMaximum_0 },
+    { "exclusiveMinimum", 0, validate_exclusiveMinimum_0, validate_exclusiveMinimum_0 },
+    { "format", 0, validate_format_0, validate_format_0 },
+    { "format", 1, validate_format_1, validate_format_1 },
+    { "format", 2, validate_format_2, validate_format_2 },
+    { "format", 3, validate_format_3, validate_format_3 },
+    { "format", 4, validate_format_4, validate_format_4 },
+    { "format", 5, validate_format_5, validate_format_5 },
+    { "format", 6, validate_format_6, validate_format_6 },
+    { "format", 7, validate_format_7, validate_format_7 },
+    { "format", 8, validate_format_8, validate_format_8 },
+    { "format", 9, validate_format_9, validate_format_9 },
+    { "format", 10, validate_format_10, validate_format_10 },
+    { "format", 11, validate_format_11, validate_format_11 },
+    { "format", 12, validate_format_12, validate_format_12 },
+    { "format", 13, validate_format_13, validate_format_13 },
+    { "format", 14, validate_format_14, validate_format_14 },
+    { "format", 15, validate_format_15, validate_format_15 },
+    { "format", 16, validate_format_16, validate_format_16 },
+    { "items", 0, validate_items_0, validate_items_0 },
+    { "items", 1, validate_items_1, validate_items_1 },
+    { "items", 2, validate_items_2, validate_items_2 },
+    { "items", 3, validate_items_3, validate_items_3 },
+    { "items", 4, validate_items_4, validate_items_4 },
+    { "items", 5, validate_items_5, validate_items_5 },
+    { "maxItems", 0, validate_maxItems_0, validate_maxItems_0 },
+    { "maxLength", 0, validate_maxLength_0, validate_maxLength_0 },
+    { "maxProperties", 0, validate_maxProperties_0, validate_maxProperties_0 },
+    { "maximum", 0, validate_maximum_0, validate_maximum_0 },
+    { "maximum", 1, validate_maximum_1, validate_maximum_1 },
+    { "minItems", 0, validate_minItems_0, validate_minItems_0 },
+    { "minLength", 0, validate_minLength_0, validate_minLength_0 },
+    { "minProperties", 0, validate_minProperties_0, validate_minProperties_0 },
+    { "minimum", 0, validate_minimum_0, validate_minimum_0 },
+    { "minimum", 1, validate_minimum_1, validate_minimum_1 },
+    { "multipleOf", 0, validate_multipleOf_0, validate_multipleOf_0 },
+    { "multipleOf", 1, validate_multipleOf_1, validate_multipleOf_1 },
+    { "multipleOf", 2, validate_multipleOf_2, validate_multipleOf_2 },
+    { "not", 0, validate_not_0, validate_not_0 },
+    { "not", 1, validate_not_1, validate_not_1 },
+    { "not", 2, validate_not_2, validate_not_2 },
+    { "not", 3, validate_not_3, validate_not_3 },
+    { "not", 4, validate_not_4, validate_not_4 },
+    { "not", 5, validate_not_5, validate_not_5 },
+    { "oneOf", 0, validate_oneOf_0, validate_oneOf_0 },
+    { "oneOf", 1, validate_oneOf_1, validate_oneOf_1 },
+    { "oneOf", 2, validate_oneOf_2, validate_oneOf_2 },
+    { "oneOf", 3, validate_oneOf_3, validate_oneOf_3 },
+    { "oneOf", 4, validate_oneOf_4, validate_oneOf_4 },
+    { "oneOf", 5, validate_oneOf_5, validate_oneOf_5 },
+    { "oneOf", 6, validate_oneOf_6, validate_oneOf_6 },
+    { "oneOf", 7, validate_oneOf_7, validate_oneOf_7 },
+    { "oneOf", 8, validate_oneOf_8, validate_oneOf_8 },
+    { "oneOf", 9, validate_oneOf_9, validate_oneOf_9 },
+    { "date-time", 0, validate_date_time_0, validate_date_time_0 },
+    { "date", 0, validate_date_0, validate_date_0 },
+    { "email", 0, validate_email_0, validate_email_0 },
+    { "email", 1, validate_email_1, validate_email_1 },
+    { "hostname", 0, validate_hostname_0, validate_hostname_0 },
+    { "ipv4", 0, validate_ipv4_0, validate_ipv4_0 },
+    { "ipv6", 0, validate_ipv6_0, validate_ipv6_0 },
+    { "time", 0, validate_time_0, validate_time_0 },
+    { "uri", 0, validate_uri_0, validate_uri_0 },
+    { "uuid", 0, validate_uuid_0, validate_uuid_0 },
+    { "pattern", 0, validate_pattern_0, validate_pattern_0 },
+    { "pattern", 1, validate_pattern_1, validate_pattern_1 },
+    { "patternProperties", 0, validate_patternProperties_0, validate_patternProperties_0 },
+    { "patternProperties", 1, validate_patternProperties_1, validate_patternProperties_1 },
+    { "patternProperties", 2, validate_patternProperties_2, validate_patternProperties_2 },
+    { "patternProperties", 3, validate_patternProperties_3, validate_patternProperties_3 },
+    { "propertyNames", 0, validate_propertyNames_0, validate_propertyNames_0 },
+    { "propertyNames", 1, validate_propertyNames_1, validate_propertyNames_1 },
+    { "propertyNames", 2, validate_propertyNames_2, validate_propertyNames_2 },
+    { "ref", 0, validate_ref_0, validate_ref_0 },
+    { "ref", 1, validate_ref_1, validate_ref_1 },
+    { "ref", 2, validate_ref_2, validate_ref_2 },
+    { "ref", 3, validate_ref_3, validate_ref_3 },
+    { "ref", 4, validate_ref_4, validate_ref_4 },
+    { "ref", 5, validate_ref_5, validate_ref_5 },
+    { "ref", 6, validate_ref_6, validate_ref_6 },
+    { "ref", 7, validate_ref_7, validate_ref_7 },
+    { "ref", 8, validate_ref_8, validate_ref_8 },
+    { "ref", 9, validate_ref_9, validate_ref_9 },
+    { "ref", 10, validate_ref_10, validate_ref_10 },
+    { "required", 0, validate_required_0, validate_required_0 },
+    { "required", 1, validate_required_1, validate_required_1 },
+    { "required", 2, validate_required_2, validate_required_2 },
+    { "required", 3, validate_required_3, validate_required_3 },
+    { "type", 0, validate_type_0, validate_type_0 },
+    { "type", 1, validate_type_1, validate_type_1 },
+    { "type", 2, validate_type_2, validate_type_2 },
+    { "type", 3, validate_type_3, validate_type_3 },
+    { "type", 4, validate_type_4, validate_type_4 },
+    { "type", 5, validate_type_5, validate_type_5 },
+    { "type", 6, validate_type_6, validate_type_6 },
+    { "type", 7, validate_type_7, validate_type_7 },
+    { "type", 8, validate_type_8, validate_type_8 },
+    { "type", 9, validate_type_9, validate_type_9 },
+    { "type", 10, validate_type_10, validate_type_10 },
+    { "uniqueItems", 0, validate_uniqueItems_0, validate_uniqueItems_0 },
+    { "uniqueItems", 1, validate_uniqueItems_1, validate_uniqueItems_1 },
+    { "uniqueItems", 2, validate_uniqueItems_2, validate_uniqueItems_2 },
+    { "numbers", 0, validate_numbers_0, validate_numbers_0 },
+    { "numbers", 1, validate_numbers_1, validate_numbers_1 },
+    { "numbers", 2, validate_numbers_2, validate_numbers_2 },
+    { "numbers", 3, validate_numbers_3, validate_numbers_3 },
+    { "numbers", 4, validate_numbers_4, validate_numbers_4 },
+    { "numbers", 5, validate_numbers_5, validate_numbers_5 },
+    { "numbers", 6, validate_numbers_6, validate_numbers_6 },
+    { "numbers", 7, validate_numbers_7, validate_numbers_7 },
+    { "tagged_unions", 0, validate_tagged_unions_0, validate_tagged_unions_0 },
+    { "tagged_unions", 1, validate_tagged_unions_1, validate_tagged_unions_1 },
+    { "tagged_unions", 2, validate_tagged_unions_2, validate_tagged_unions_2 },
+};
+
+const size_t generated_validators_count = 178;
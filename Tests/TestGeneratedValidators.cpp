@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/TestSuite.h>
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <LibJsonValidator/Parser.h>
+#include <LibJsonValidator/Validator.h>
+
+#include "GeneratedValidators.h"
+
+// Runs the draft2019-09 suite of that name, or with execute_file() a suite of this implementation.
+inline void execute(const String name, bool assert_formats = false);
+inline void execute_file(const String filename, bool assert_formats = false);
+
+TEST_CASE(additionalItems) { execute("additionalItems"); }
+TEST_CASE(additionalProperties) { execute("additionalProperties"); }
+TEST_CASE(allOf) { execute("allOf"); }
+TEST_CASE(anchor) { execute("anchor"); }
+TEST_CASE(anyOf) { execute("anyOf"); }
+TEST_CASE(boolean_schema) { execute("boolean_schema"); }
+TEST_CASE(contains) { execute("contains"); }
+TEST_CASE(const_) { execute("const"); }
+TEST_CASE(default_) { execute("default"); }
+TEST_CASE(dependentRequired) { execute("dependentRequired"); }
+TEST_CASE(dependentSchemas) { execute("dependentSchemas"); }
+TEST_CASE(enum_) { execute("enum"); }
+TEST_CASE(exclusiveMaximum) { execute("exclusiveMaximum"); }
+TEST_CASE(exclusiveMinimum) { execute("exclusiveMinimum"); }
+TEST_CASE(defs) { execute("defs"); }
+TEST_CASE(format) { execute("format", true); }
+TEST_CASE(items) { execute("items"); }
+TEST_CASE(maximum) { execute("maximum"); }
+TEST_CASE(maxItems) { execute("maxItems"); }
+TEST_CASE(maxLength) { execute("maxLength"); }
+TEST_CASE(maxProperties) { execute("maxProperties"); }
+TEST_CASE(minimum) { execute("minimum"); }
+TEST_CASE(minItems) { execute("minItems"); }
+TEST_CASE(minLength) { execute("minLength"); }
+TEST_CASE(minProperties) { execute("minProperties"); }
+TEST_CASE(multipleOf) { execute("multipleOf"); }
+TEST_CASE(not_) { execute("not"); }
+TEST_CASE(oneOf) { execute("oneOf"); }
+TEST_CASE(pattern) { execute("pattern"); }
+TEST_CASE(patternProperties) { execute("patternProperties"); }
+TEST_CASE(propertyNames) { execute("propertyNames"); }
+TEST_CASE(ref) { execute("ref"); }
+TEST_CASE(required) { execute("required"); }
+TEST_CASE(type) { execute("type"); }
+TEST_CASE(uniqueItems) { execute("uniqueItems"); }
+
+TEST_CASE(optional_format_date_time) { execute("optional/format/date-time", true); }
+TEST_CASE(optional_format_date) { execute("optional/format/date", true); }
+TEST_CASE(optional_format_time) { execute("optional/format/time", true); }
+TEST_CASE(optional_format_ipv4) { execute("optional/format/ipv4", true); }
+TEST_CASE(optional_format_ipv6) { execute("optional/format/ipv6", true); }
+TEST_CASE(optional_format_uuid) { execute("optional/format/uuid", true); }
+TEST_CASE(optional_format_email) { execute("optional/format/email", true); }
+TEST_CASE(optional_format_hostname) { execute("optional/format/hostname", true); }
+TEST_CASE(optional_format_uri) { execute("optional/format/uri", true); }
+
+TEST_CASE(numbers) { execute_file("resource/jsonvalidator/numbers.json"); }
+TEST_CASE(tagged_unions) { execute_file("resource/jsonvalidator/tagged_unions.json"); }
+
+TEST_MAIN(GeneratedValidators)
+
+static const GeneratedValidator* find_generated_validator(const String& suite, size_t index)
+{
+    for (size_t i = 0; i < generated_validators_count; ++i) {
+        auto& validator = generated_validators[i];
+        if (suite == validator.suite && index == validator.index)
+            return &validator;
+    }
+    return nullptr;
+}
+
+inline void execute(const String name, bool assert_formats)
+{
+    execute_file(String::format("resource/draft2019-09/%s.json", name.characters()), assert_formats);
+}
+
+inline void execute_file(const String filename, bool assert_formats)
+{
+    FILE* fp = fopen(filename.characters(), "r");
+    ASSERT(fp);
+
+    StringBuilder builder;
+    for (;;) {
+        char buffer[1024];
+        if (!fgets(buffer, sizeof(buffer), fp))
+            break;
+        builder.append(buffer);
+    }
+
+    fclose(fp);
+
+    JsonValue test_json = JsonValue::from_string(builder.to_string());
+    ASSERT(test_json.is_array());
+
+    JsonValidator::Parser parser;
+    parser.set_assert_formats(assert_formats);
+    JsonValidator::Validator validator;
+    validator.set_validate_embedded_defs(true);
+
+    // the generated validators are named after the file, without its directory
+    auto suite = filename.split('/').last();
+    suite = suite.substring(0, suite.length() - 5);
+
+    auto& cases = test_json.as_array().values();
+    for (size_t index = 0; index < cases.size(); ++index) {
+        auto item_obj = cases[index].as_object();
+
+        printf("CASE \"%s\":\n", item_obj.get("description").as_string().characters());
+        printf("==============================\n");
+
+        auto* generated = find_generated_validator(suite, index);
+        EXPECT(generated != nullptr);
+        if (!generated) {
+            printf("No generated validator, regenerate GeneratedValidators.cpp\n");
+            continue;
+        }
+
+        JsonValue res = parser.run(item_obj.get("schema"));
+        EXPECT(res.is_bool() && res.as_bool());
+
+        bool at_least_one_invalid = false;
+
+        auto tests = item_obj.get("tests");
+        ASSERT(tests.is_array());
+
+        for (auto& test_item : tests.as_array().values()) {
+            auto test_item_obj = test_item.as_object();
+            auto data = test_item_obj.get("data");
+            bool valid = test_item_obj.get("valid").as_bool();
+
+            printf("%s: ", test_item_obj.get("description").as_string().characters());
+
+            JsonValidator::ValidationError e;
+            bool success = generated->validate(data, e);
+            success &= JsonValidator::validate_embedded_defs(data, &e);
+
+            // the generated code must agree with the interpreter, error for error
+            JsonValidator::ValidationResult vr = validator.run(parser, data);
+            EXPECT(success == vr.success);
+            EXPECT(e.errors().size() == vr.e.errors().size());
+            for (size_t i = 0; i < e.records().size() && i < vr.e.records().size(); ++i) {
+                EXPECT(e.records()[i].location == vr.e.records()[i].location);
+                EXPECT(e.records()[i].instance_location == vr.e.records()[i].instance_location);
+                EXPECT(e.records()[i].to_string() == vr.e.records()[i].to_string());
+            }
+            EXPECT((generated->is_valid(data) && JsonValidator::validate_embedded_defs(data, nullptr)) == success);
+
+            if (valid)
+                EXPECT(!e.errors().size());
+
+            if (valid == success) {
+                printf("✔\n");
+            } else {
+                printf("✘\n");
+                at_least_one_invalid = true;
+            }
+
+            EXPECT(valid == success);
+        }
+        printf("\n");
+
+        if (at_least_one_invalid)
+            throw TestException(__FILE__, __LINE__, "Test failed");
+    }
+}
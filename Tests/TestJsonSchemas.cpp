@@ -29,13 +29,23 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
+#include <AK/StdLibExtras.h>
 #include <AK/String.h>
 #include <AK/StringBuilder.h>
+#include <AK/Vector.h>
 #include <LibJsonValidator/JsonSchemaNode.h>
 #include <LibJsonValidator/Parser.h>
+#include <LibJsonValidator/Profile.h>
+#include <LibJsonValidator/Regex.h>
+#include <LibJsonValidator/StreamingValidator.h>
 #include <LibJsonValidator/Validator.h>
+#include <pthread.h>
+#include <string.h>
 
-inline void execute(const String name);
+// Runs the draft2019-09 suite of that name, or with execute_file() a suite of this implementation.
+inline void execute(const String name, bool assert_formats = false);
+inline void execute_file(const String filename, bool assert_formats = false);
+inline void expect_optimized(const char* schema, const char* report_line, const Vector<const char*>& valid, const Vector<const char*>& invalid);
 
 TEST_CASE(additionalItems) { execute("additionalItems"); }
 TEST_CASE(additionalProperties) { execute("additionalProperties"); }
@@ -52,7 +62,7 @@ TEST_CASE(enum_) { execute("enum"); }
 TEST_CASE(exclusiveMaximum) { execute("exclusiveMaximum"); }
 TEST_CASE(exclusiveMinimum) { execute("exclusiveMinimum"); }
 TEST_CASE(defs) { execute("defs"); }
-TEST_CASE(format) { execute("format"); }
+TEST_CASE(format) { execute("format", true); }
 TEST_CASE(items) { execute("items"); }
 TEST_CASE(maximum) { execute("maximum"); }
 TEST_CASE(maxItems) { execute("maxItems"); }
@@ -73,16 +83,413 @@ TEST_CASE(required) { execute("required"); }
 TEST_CASE(type) { execute("type"); }
 TEST_CASE(uniqueItems) { execute("uniqueItems"); }
 
+TEST_CASE(optional_format_date_time) { execute("optional/format/date-time", true); }
+TEST_CASE(optional_format_date) { execute("optional/format/date", true); }
+TEST_CASE(optional_format_time) { execute("optional/format/time", true); }
+TEST_CASE(optional_format_ipv4) { execute("optional/format/ipv4", true); }
+TEST_CASE(optional_format_ipv6) { execute("optional/format/ipv6", true); }
+TEST_CASE(optional_format_uuid) { execute("optional/format/uuid", true); }
+TEST_CASE(optional_format_email) { execute("optional/format/email", true); }
+TEST_CASE(optional_format_hostname) { execute("optional/format/hostname", true); }
+TEST_CASE(optional_format_uri) { execute("optional/format/uri", true); }
+
+TEST_CASE(numbers) { execute_file("resource/jsonvalidator/numbers.json"); }
+TEST_CASE(tagged_unions) { execute_file("resource/jsonvalidator/tagged_unions.json"); }
+
+// The optimizer folds these schemas, which must not change any verdict.
+TEST_CASE(optimizer_unsatisfiable)
+{
+    expect_optimized(R"({"type": "number", "minimum": 5, "maximum": 3})",
+        "sub0 (#): no instance can match the keywords of this schema", {}, { "4", "5", "\"x\"" });
+    expect_optimized(R"({"properties": {"a": {"anyOf": [{"type": "integer", "minimum": 5, "maximum": 3}, {"type": "string"}]}}})",
+        "sub1 (#/properties/a): removed anyOf branch sub3, it never matches", { R"({"a": "x"})", "{}" }, { R"({"a": 4})", R"({"a": 5})" });
+}
+
+TEST_CASE(optimizer_not_not)
+{
+    expect_optimized(R"({"not": {"not": {"type": "string"}}})",
+        "sub0 (#): folded double negation of sub2", { "\"s\"" }, { "1", "null", "{}" });
+}
+
+TEST_CASE(optimizer_always_valid_any_of)
+{
+    expect_optimized(R"({"anyOf": [{"type": "string"}, {}]})",
+        "sub0 (#): removed anyOf, branch sub2 accepts every instance", { "1", "\"s\"", "[]" }, {});
+}
+
+// Enums compare numbers by value, so an integral double in an enum matches integers.
+TEST_CASE(optimizer_integral_enum_items)
+{
+    expect_optimized(R"({"anyOf": [{"type": "integer", "enum": [1.0]}, {"type": "string"}]})",
+        nullptr, { "1", "\"x\"" }, { "2", "1.5" });
+    expect_optimized(R"({"anyOf": [{"type": "integer", "const": 2.0}, {"type": "string"}]})",
+        nullptr, { "2", "\"x\"" }, { "1" });
+    expect_optimized(R"({"anyOf": [{"type": "integer", "enum": [1.5]}, {"type": "string"}]})",
+        "sub0 (#): removed anyOf branch sub1, it never matches", { "\"x\"" }, { "1", "1.5" });
+}
+
+// Arrays of 64Ki items and more are checked for duplicates by sorting.
+TEST_CASE(unique_items_large_array)
+{
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(R"({"uniqueItems": true})"));
+    EXPECT(res.is_bool() && res.as_bool());
+
+    JsonArray array;
+    for (int i = 0; i < 70000; ++i)
+        array.append(String::format("item%d", i));
+
+    JsonValidator::Validator validator;
+    EXPECT(validator.run(parser, array).success);
+
+    // the first item that has an equal one before it is reported
+    array.append("item9");
+    array.append("item7");
+    auto vr = validator.run(parser, array);
+    EXPECT(!vr.success);
+    EXPECT(vr.e.records().size() == 1);
+    EXPECT(vr.e.records().size() && vr.e.records()[0].detail == "\"item9\"");
+}
+
+// More keys than are cached per property table, so classifications are replaced, and
+// keys seen before are classified again in the later records.
+TEST_CASE(key_classifications_replaced)
+{
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(R"({
+        "items": { "patternProperties": { "^k": { "type": "integer" } }, "additionalProperties": false }
+    })"));
+    EXPECT(res.is_bool() && res.as_bool());
+
+    auto records = [](const char* last_key, const char* last_value) {
+        StringBuilder builder;
+        builder.append('[');
+        for (int record = 0; record < 3; ++record) {
+            builder.append(record ? ",{" : "{");
+            for (int i = 0; i < 1500; ++i)
+                builder.appendf("%s\"k%d\":%d", i ? "," : "", (record * 700 + i) % 2000, i);
+            builder.append('}');
+        }
+        builder.appendf(",{\"%s\":%s}]", last_key, last_value);
+        return builder.build();
+    };
+
+    struct Case {
+        String text;
+        bool valid;
+    };
+    Case cases[] = { { records("k5", "1"), true }, { records("k5", "\"s\""), false }, { records("x", "1"), false } };
+    for (auto& c : cases) {
+        JsonValidator::Validator validator;
+        EXPECT_EQ(validator.run(parser, JsonValue::from_string(c.text)).success, c.valid);
+
+        JsonValidator::StreamingValidator streaming_validator(*parser.program(), nullptr);
+        streaming_validator.append(c.text.characters(), c.text.length());
+        EXPECT_EQ(streaming_validator.finish(), c.valid);
+    }
+}
+
+// Errors below the root name the failing keyword's schema location and the instance location,
+// with the segments of both escaped as JSON pointers.
+TEST_CASE(nested_error_locations)
+{
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(R"({
+        "properties": { "a": { "items": { "properties": { "b~/c": { "type": "string" }, "d": { "minimum": 3 } } } } }
+    })"));
+    EXPECT(res.is_bool() && res.as_bool());
+
+    const char* text = R"({ "a": [ { "b~/c": "x" }, { "b~/c": 1, "d": 2 } ] })";
+    auto vr = JsonValidator::Validator().run(parser, JsonValue::from_string(text));
+    EXPECT(!vr.success);
+    auto& records = vr.e.records();
+    EXPECT_EQ(records.size(), 2u);
+    if (records.size() != 2)
+        return;
+
+    EXPECT_EQ(records[0].location, "#/properties/a/items/properties/b~0~1c");
+    EXPECT_EQ(records[0].instance_location, "/a/1/b~0~1c");
+    EXPECT_EQ(records[0].to_string(), "/a/1/b~0~1c: type validation failed: have '1', but looking for node with type 'string'");
+    EXPECT_EQ(records[1].location, "#/properties/a/items/properties/d");
+    EXPECT_EQ(records[1].instance_location, "/a/1/d");
+    EXPECT_EQ(records[1].to_string(), "/a/1/d: Minimum invalid: value is 2.000000, allowed is: 3.000000 at #/properties/a/items/properties/d, 2");
+
+    // a streamed document reports the same locations
+    JsonValidator::ValidationError streamed_e;
+    JsonValidator::StreamingValidator streaming_validator(*parser.program(), &streamed_e);
+    streaming_validator.append(text, strlen(text));
+    EXPECT(!streaming_validator.finish());
+    EXPECT_EQ(streamed_e.records().size(), 2u);
+    for (size_t i = 0; i < streamed_e.records().size() && i < records.size(); ++i) {
+        EXPECT_EQ(streamed_e.records()[i].location, records[i].location);
+        EXPECT_EQ(streamed_e.records()[i].to_string(), records[i].to_string());
+    }
+}
+
+// A recorded profile survives the round trip through JSON, and moves the branch that
+// matched most in front without changing any verdict.
+static Vector<String> branch_order(const JsonValidator::Program& program)
+{
+    Vector<String> locations;
+    for (auto& insn : program.code()) {
+        if (insn.opcode == JsonValidator::OpCode::CallBranch)
+            locations.append(program.location(insn.a));
+    }
+    return locations;
+}
+
+TEST_CASE(profile_orders_branches)
+{
+    const char* schema = R"({"anyOf": [{"type": "string", "minLength": 3}, {"type": "array", "minItems": 1}, {"type": "integer", "minimum": 0}]})";
+    const char* valid[] = { "5", "\"abc\"", "[1]", "0" };
+    const char* invalid[] = { "-1", "\"ab\"", "[]", "null" };
+
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(schema));
+    EXPECT(res.is_bool() && res.as_bool());
+    auto unprofiled_order = branch_order(*parser.program());
+    EXPECT_EQ(unprofiled_order.size(), 3u);
+
+    JsonValidator::Profile recorded;
+    JsonValidator::Validator validator;
+    validator.set_profile(&recorded);
+    for (int i = 0; i < 20; ++i)
+        EXPECT(validator.run(parser, JsonValue::from_string(String::format("%d", i))).success);
+    EXPECT(validator.run(parser, JsonValue::from_string("\"abc\"")).success);
+    EXPECT(!recorded.is_empty());
+
+    JsonValidator::Profile loaded;
+    EXPECT(loaded.load(JsonValue::from_string(recorded.to_json().to_string())));
+    EXPECT_EQ(loaded.to_json().to_string(), recorded.to_json().to_string());
+
+    JsonValidator::Parser profiled_parser;
+    profiled_parser.set_profile(&loaded);
+    res = profiled_parser.run(JsonValue::from_string(schema));
+    EXPECT(res.is_bool() && res.as_bool());
+    auto profiled_order = branch_order(*profiled_parser.program());
+    EXPECT_EQ(profiled_order.size(), 3u);
+    if (unprofiled_order.size() != 3 || profiled_order.size() != 3)
+        return;
+    EXPECT_EQ(profiled_order[0], unprofiled_order[2]);
+    EXPECT_EQ(profiled_order[1], unprofiled_order[0]);
+    EXPECT_EQ(profiled_order[2], unprofiled_order[1]);
+
+    for (auto* text : valid)
+        EXPECT(JsonValidator::Validator().run(profiled_parser, JsonValue::from_string(text)).success);
+    for (auto* text : invalid)
+        EXPECT(!JsonValidator::Validator().run(profiled_parser, JsonValue::from_string(text)).success);
+}
+
+TEST_CASE(profile_rejects_malformed)
+{
+    const char* malformed[] = {
+        "[]",
+        R"({"branches": []})",
+        R"({"branches": {"#/anyOf/0": 1}})",
+        R"({"branches": {"#/anyOf/0": {"evaluations": 2, "matches": 1}}})",
+        R"({"branches": {"#/anyOf/0": {"evaluations": 2, "matches": "1", "cost": 3}}})",
+        R"({"branches": {"#/anyOf/0": {"evaluations": 2, "matches": 1, "cost": -3}}})",
+        R"({"branches": {"#/anyOf/0": {"evaluations": 2, "matches": 1.5, "cost": 3}}})",
+        R"({"branches": {"#/anyOf/0": {"evaluations": 1, "matches": 2, "cost": 3}}})",
+        R"({"branches": {"#/anyOf/1": {"evaluations": 2, "matches": 1, "cost": 3}, "#/anyOf/0": {}}})",
+    };
+    for (auto* text : malformed) {
+        JsonValidator::Profile profile;
+        EXPECT(!profile.load(JsonValue::from_string(text)));
+        EXPECT(profile.is_empty());
+    }
+
+    JsonValidator::Profile profile;
+    EXPECT(profile.load(JsonValue::from_string(R"({"branches": {"#/anyOf/0": {"evaluations": 2, "matches": 1, "cost": 3}}})")));
+    auto* statistics = profile.branch("#/anyOf/0");
+    EXPECT(statistics && statistics->evaluations == 2 && statistics->matches == 1 && statistics->cost == 3);
+}
+
+// Key classifications are kept by the program, so they carry over from one run to the
+// next, and are shared by the threads validating with it.
+static const char* s_key_classification_schema = R"({
+    "patternProperties": { "^k": { "type": "integer" } },
+    "propertyNames": { "maxLength": 4 },
+    "additionalProperties": false
+})";
+
+static String key_classification_record(u32 first, u32 step)
+{
+    StringBuilder builder;
+    builder.append('{');
+    for (u32 i = 0; i < 10; ++i)
+        builder.appendf("%s\"k%u\":%u", i ? "," : "", (first + i * step) % 2000, i);
+    builder.append('}');
+    return builder.build();
+}
+
+struct KeyClassificationThread {
+    const JsonValidator::Parser* parser { nullptr };
+    u32 seed { 0 };
+    size_t mismatches { 0 };
+};
+
+static void* validate_records_in_thread(void* argument)
+{
+    auto& thread = *reinterpret_cast<KeyClassificationThread*>(argument);
+    for (u32 i = 0; i < 300; ++i) {
+        u32 first = (thread.seed + i * 7) % 2000;
+        u32 step = 1 + i % 13;
+        // keys from k1000 on are longer than propertyNames allows
+        bool expected = true;
+        for (u32 j = 0; j < 10; ++j)
+            expected &= (first + j * step) % 2000 < 1000;
+        if (JsonValidator::Validator().run(*thread.parser, JsonValue::from_string(key_classification_record(first, step))).success != expected)
+            ++thread.mismatches;
+    }
+    return nullptr;
+}
+
+TEST_CASE(key_classifications_shared_between_runs)
+{
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(s_key_classification_schema));
+    EXPECT(res.is_bool() && res.as_bool());
+
+    EXPECT(JsonValidator::Validator().run(parser, JsonValue::from_string(R"({"k1": 1, "kkkkk": 2})")).success == false);
+    JsonValidator::KeyClassification classification;
+    EXPECT(parser.program()->find_key_classification(0, "k1", classification));
+    EXPECT_EQ(classification.patterns.size(), 1u);
+    EXPECT(classification.property_name_valid);
+    EXPECT(parser.program()->find_key_classification(0, "kkkkk", classification));
+    EXPECT(!classification.property_name_valid);
+
+    // later runs find the classifications, whether the document is parsed or streamed
+    EXPECT(JsonValidator::Validator().run(parser, JsonValue::from_string(R"({"k1": 3})")).success);
+    EXPECT(!JsonValidator::Validator().run(parser, JsonValue::from_string(R"({"k1": "x"})")).success);
+    struct Case {
+        const char* text;
+        bool valid;
+    };
+    for (auto& c : { Case { R"({"k1": 3})", true }, Case { R"({"kkkkk": 3})", false }, Case { R"({"x": 3})", false } }) {
+        JsonValidator::StreamingValidator streaming_validator(*parser.program(), nullptr);
+        streaming_validator.append(c.text, strlen(c.text));
+        EXPECT_EQ(streaming_validator.finish(), c.valid);
+    }
+
+    // more keys than are cached, so the threads replace each other's classifications
+    KeyClassificationThread threads[4];
+    pthread_t handles[4];
+    for (u32 i = 0; i < 4; ++i) {
+        threads[i] = { &parser, i * 500, 0 };
+        EXPECT(!pthread_create(&handles[i], nullptr, validate_records_in_thread, &threads[i]));
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        pthread_join(handles[i], nullptr);
+        EXPECT_EQ(threads[i].mismatches, 0u);
+    }
+}
+
+// The lazily built DFA of a pattern is shared by the threads matching with it. This
+// pattern needs more DFA states than are cached, so the DFA is reset while matching.
+struct RegexThread {
+    const JsonValidator::Regex* regex { nullptr };
+    const Vector<String>* inputs { nullptr };
+    const Vector<bool>* expected { nullptr };
+    size_t mismatches { 0 };
+};
+
+static void* search_in_thread(void* argument)
+{
+    auto& thread = *reinterpret_cast<RegexThread*>(argument);
+    for (int round = 0; round < 20; ++round) {
+        for (size_t i = 0; i < thread.inputs->size(); ++i) {
+            auto& input = thread.inputs->at(i);
+            if (thread.regex->search(input.characters(), input.length()) != thread.expected->at(i))
+                ++thread.mismatches;
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE(regex_shared_between_threads)
+{
+    const char* pattern = "a[ab]{10}b";
+    Vector<String> inputs;
+    Vector<bool> expected;
+    u32 seed = 1;
+    for (int i = 0; i < 500; ++i) {
+        StringBuilder builder;
+        for (int j = 0; j < 40; ++j) {
+            seed = seed * 1103515245 + 12345;
+            builder.append("abc"[(seed >> 16) % 3]);
+        }
+        inputs.append(builder.build());
+        JsonValidator::Regex fresh(pattern);
+        expected.append(fresh.search(inputs.last().characters(), inputs.last().length()));
+    }
+    EXPECT(expected.contains_slow(true) && expected.contains_slow(false));
+
+    JsonValidator::Regex shared(pattern);
+    RegexThread threads[4];
+    pthread_t handles[4];
+    for (size_t i = 0; i < 4; ++i) {
+        threads[i] = { &shared, &inputs, &expected, 0 };
+        EXPECT(!pthread_create(&handles[i], nullptr, search_in_thread, &threads[i]));
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        pthread_join(handles[i], nullptr);
+        EXPECT_EQ(threads[i].mismatches, 0u);
+    }
+}
+
+// A DFA can't match lookaround, backreferences or word boundaries, so schemas using them
+// are rejected instead of never matching.
+TEST_CASE(unsupported_patterns_rejected)
+{
+    const char* schemas[] = {
+        "{\"pattern\": \"a(?=b)\"}",
+        "{\"pattern\": \"(a)\\\\1\"}",
+        "{\"pattern\": \"\\\\bword\"}",
+        "{\"pattern\": \"(a\"}",
+        "{\"properties\": {\"a\": {\"type\": \"string\", \"pattern\": \"(?!x)\"}}}",
+        "{\"patternProperties\": {\"(?<=a)b\": {\"type\": \"integer\"}}}",
+    };
+    for (auto* schema : schemas) {
+        JsonValidator::Parser parser;
+        JsonValue res = parser.run(JsonValue::from_string(schema));
+        EXPECT(res.is_array() && res.as_array().size() == 1);
+    }
+
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(R"({"pattern": "^a(b|c)+$", "patternProperties": {"^x": {}}})"));
+    EXPECT(res.is_bool() && res.as_bool());
+}
+
 TEST_MAIN(JsonSchemas)
 
-inline void execute(const String name)
+inline void expect_optimized(const char* schema, const char* report_line, const Vector<const char*>& valid, const Vector<const char*>& invalid)
 {
-    StringBuilder filename;
-    filename.append("resource/draft2019-09/");
-    filename.append(name);
-    filename.append(".json");
+    JsonValidator::Parser parser;
+    JsonValue res = parser.run(JsonValue::from_string(schema));
+    EXPECT(res.is_bool() && res.as_bool());
+
+    // without a line, nothing may be folded
+    bool reported = !report_line && parser.optimizer_report().is_empty();
+    for (auto& line : parser.optimizer_report())
+        reported |= report_line && line == report_line;
+    EXPECT(reported);
+
+    JsonValidator::Validator validator;
+    for (auto* data : valid)
+        EXPECT(validator.run(parser, JsonValue::from_string(data)).success);
+    for (auto* data : invalid)
+        EXPECT(!validator.run(parser, JsonValue::from_string(data)).success);
+}
 
-    FILE* fp = fopen(filename.build().characters(), "r");
+inline void execute(const String name, bool assert_formats)
+{
+    execute_file(String::format("resource/draft2019-09/%s.json", name.characters()), assert_formats);
+}
+
+inline void execute_file(const String filename, bool assert_formats)
+{
+    FILE* fp = fopen(filename.characters(), "r");
     ASSERT(fp);
 
     StringBuilder builder;
@@ -99,7 +506,10 @@ inline void execute(const String name)
     ASSERT(test_json.is_array());
 
     JsonValidator::Parser parser;
+    parser.set_assert_formats(assert_formats);
     JsonValidator::Validator validator;
+    // defs.json validates schemas embedded in the instance against the meta-schema
+    validator.set_validate_embedded_defs(true);
 
     for (auto& item : test_json.as_array().values()) {
         ASSERT(item.is_object());
@@ -149,6 +559,23 @@ inline void execute(const String name)
 
             bool valid = test_item_obj.get("valid").as_bool();
 
+            // stopping at the first failure must not change the verdict
+            EXPECT(validator.is_valid(parser, test_item_obj.get("data")) == vr.success);
+
+            // a streamed document gets the verdict of the parsed one, also in chunks that split its tokens
+            auto text = JsonValidator::excerpt(test_item_obj.get("data"), SIZE_MAX);
+            bool parsed_valid = JsonValidator::Validator().is_valid(parser, JsonValue::from_string(text));
+            JsonValidator::ValidationError streamed_e;
+            JsonValidator::StreamingValidator streaming_validator(*parser.program(), &streamed_e);
+            for (size_t i = 0; i < text.length(); i += 3)
+                streaming_validator.append(text.characters() + i, min((size_t)3, text.length() - i));
+            bool streamed_valid = streaming_validator.finish();
+            EXPECT(streamed_valid == parsed_valid);
+            EXPECT(streamed_valid == !streamed_e.has_error());
+            JsonValidator::StreamingValidator muted_streaming_validator(*parser.program(), nullptr);
+            muted_streaming_validator.append(text.characters(), text.length());
+            EXPECT(muted_streaming_validator.finish() == parsed_valid);
+
             if (valid) {
                 EXPECT(!vr.e.errors().size());
                 for (auto& err : vr.e.errors()) {
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020, Emanuel Sprung <emanuel.sprung@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/File.h>
+#include <LibJsonValidator/Generator.h>
+#include <LibJsonValidator/JsonSchemaNode.h>
+#include <LibJsonValidator/Parser.h>
+#include <LibJsonValidator/Profile.h>
+#include <stdio.h>
+#include <string.h>
+
+static void print_usage()
+{
+    fprintf(stderr, "usage: jsonvalidator-generate [--assert-formats] [--profile <profile-file>] <schema-file> <function-name>\n");
+    fprintf(stderr, "       jsonvalidator-generate [--assert-formats] [--profile <profile-file>] --suite <test-suite-file>...\n");
+}
+
+static bool s_assert_formats = false;
+static bool s_use_profile = false;
+static JsonValidator::Profile s_profile;
+
+static Optional<JsonValue> read_json(const char* filename)
+{
+    auto file = Core::File::construct(filename);
+    if (!file->open(Core::IODevice::ReadOnly)) {
+        fprintf(stderr, "Couldn't open %s for reading: %s\n", filename, file->error_string());
+        return {};
+    }
+    return JsonValue::from_string(file->read_all());
+}
+
+static bool generate_validator(StringBuilder& builder, const JsonValue& schema, const String& function_name)
+{
+    JsonValidator::Parser parser;
+    parser.set_assert_formats(s_assert_formats);
+    if (s_use_profile)
+        parser.set_profile(&s_profile);
+    JsonValue parser_result = parser.run(schema);
+    if (!parser_result.is_bool() || !parser_result.as_bool() || !parser.program()) {
+        fprintf(stderr, "Parsing of schema for %s invalid: %s\n", function_name.characters(), parser_result.to_string().characters());
+        return false;
+    }
+
+    JsonValidator::Generator(*parser.program(), function_name).generate(builder);
+    return true;
+}
+
+static String suite_name(const char* filename)
+{
+    String name = filename;
+    auto parts = name.split('/');
+    if (parts.size())
+        name = parts.last();
+    if (name.ends_with(".json"))
+        name = name.substring(0, name.length() - 5);
+    return name;
+}
+
+// Emits one validator per schema of the JSON-Schema-Test-Suite style files and a
+// table to look them up by suite name and index, see Tests/GeneratedValidators.h.
+static int generate_suite(int argc, char** argv)
+{
+    StringBuilder builder;
+    JsonValidator::Generator::generate_preamble(builder);
+    builder.append("#include \"GeneratedValidators.h\"\n");
+
+    StringBuilder table;
+    table.append("\nconst GeneratedValidator generated_validators[] = {\n");
+    size_t count = 0;
+
+    for (int i = 2; i < argc; ++i) {
+        auto suite = read_json(argv[i]);
+        if (!suite.has_value() || !suite.value().is_array()) {
+            fprintf(stderr, "%s is not a test suite\n", argv[i]);
+            return 1;
+        }
+
+        auto name = suite_name(argv[i]);
+        // date-time.json becomes validate_date_time_<index>
+        auto identifier = name;
+        identifier.replace("-", "_", true);
+        auto& cases = suite.value().as_array().values();
+        for (size_t index = 0; index < cases.size(); ++index) {
+            auto function_name = String::format("validate_%s_%zu", identifier.characters(), index);
+            if (!generate_validator(builder, cases[index].as_object().get("schema"), function_name))
+                return 1;
+            table.appendf("    { \"%s\", %zu, %s, %s },\n", name.characters(), index, function_name.characters(), function_name.characters());
+            ++count;
+        }
+    }
+
+    table.append("};\n");
+    table.appendf("\nconst size_t generated_validators_count = %zu;\n", count);
+    builder.append(table.to_string());
+
+    auto source = builder.to_string();
+    fwrite(source.characters(), 1, source.length(), stdout);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+#ifdef __serenity__
+    if (pledge("stdio rpath", nullptr) < 0) {
+        perror("pledge");
+        return 1;
+    }
+#endif
+
+    while (argc >= 2 && !strncmp(argv[1], "--", 2)) {
+        if (!strcmp(argv[1], "--assert-formats")) {
+            s_assert_formats = true;
+        } else if (argc >= 3 && !strcmp(argv[1], "--profile")) {
+            if (!s_profile.load_file(argv[2]))
+                return 1;
+            s_use_profile = true;
+            --argc;
+            ++argv;
+        } else {
+            break;
+        }
+        --argc;
+        ++argv;
+    }
+
+    if (argc >= 3 && !strcmp(argv[1], "--suite"))
+        return generate_suite(argc, argv);
+
+    if (argc != 3) {
+        print_usage();
+        return 1;
+    }
+
+    auto schema = read_json(argv[1]);
+    if (!schema.has_value())
+        return 1;
+
+    StringBuilder builder;
+    JsonValidator::Generator::generate_preamble(builder);
+    if (!generate_validator(builder, schema.value(), argv[2]))
+        return 1;
+
+    auto source = builder.to_string();
+    fwrite(source.characters(), 1, source.length(), stdout);
+    return 0;
+}
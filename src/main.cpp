@@ -30,24 +30,58 @@
 #include <LibCore/File.h>
 #include <LibJsonValidator/JsonSchemaNode.h>
 #include <LibJsonValidator/Parser.h>
+#include <LibJsonValidator/Profile.h>
 #include <LibJsonValidator/Validator.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 
 int main(int argc, char** argv)
 {
 #ifdef __serenity__
-    if (pledge("stdio rpath", nullptr) < 0) {
+    if (pledge("stdio rpath wpath cpath", nullptr) < 0) {
         perror("pledge");
         return 1;
     }
 #endif
 
+    bool assert_formats = false;
+    bool validate_embedded_defs = false;
+    bool print_optimizer_report = false;
+    const char* profile_filename = nullptr;
+    const char* record_profile_filename = nullptr;
+    while (argc >= 2 && !strncmp(argv[1], "--", 2)) {
+        if (!strcmp(argv[1], "--assert-formats")) {
+            assert_formats = true;
+        } else if (!strcmp(argv[1], "--validate-embedded-defs")) {
+            validate_embedded_defs = true;
+        } else if (!strcmp(argv[1], "--optimizer-report")) {
+            print_optimizer_report = true;
+        } else if (argc >= 3 && !strcmp(argv[1], "--profile")) {
+            profile_filename = argv[2];
+            --argc;
+            ++argv;
+        } else if (argc >= 3 && !strcmp(argv[1], "--record-profile")) {
+            record_profile_filename = argv[2];
+            --argc;
+            ++argv;
+        } else {
+            break;
+        }
+        --argc;
+        ++argv;
+    }
+
     if (argc != 3) {
-        fprintf(stderr, "usage: jsonvalidator <schema-file> <json-file>\n");
+        fprintf(stderr, "usage: jsonvalidator [--assert-formats] [--validate-embedded-defs] [--optimizer-report] [--profile <profile-file>] [--record-profile <profile-file>] <schema-file> <json-file>\n");
         return 0;
     }
 
+    // The profile to compile with, and to add the branch statistics of this run to.
+    JsonValidator::Profile profile;
+    if (profile_filename && !profile.load_file(profile_filename))
+        return 1;
+
     auto schema_file = Core::File::construct(argv[1]);
     if (!schema_file->open(Core::IODevice::ReadOnly)) {
         fprintf(stderr, "Couldn't open %s for reading: %s\n", argv[1], schema_file->error_string());
@@ -61,7 +95,7 @@ int main(int argc, char** argv)
     }
 
 #ifdef __serenity__
-    if (pledge("stdio", nullptr) < 0) {
+    if (pledge(record_profile_filename ? "stdio wpath cpath" : "stdio", nullptr) < 0) {
         perror("pledge");
         return 1;
     }
@@ -70,9 +104,16 @@ int main(int argc, char** argv)
     auto schema_json = JsonValue::from_string(schema_file->read_all());
 
     JsonValidator::Parser parser;
+    parser.set_assert_formats(assert_formats);
+    if (profile_filename)
+        parser.set_profile(&profile);
     JsonValue parser_result = parser.run(schema_json);
     if (parser_result.is_bool() && parser_result.as_bool()) {
         fprintf(stdout, "Parsing of schema %s sucessfull.\n", argv[1]);
+        if (print_optimizer_report) {
+            for (auto& line : parser.optimizer_report())
+                fprintf(stdout, "optimizer: %s\n", line.characters());
+        }
         //parser.root_node()->dump(0);
 
     } else {
@@ -82,10 +123,14 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    auto json_file_content = JsonValue::from_string(json_file->read_all());
-
     JsonValidator::Validator validator;
-    JsonValidator::ValidationResult r = validator.run(parser, json_file_content);
+    validator.set_validate_embedded_defs(validate_embedded_defs);
+    if (record_profile_filename)
+        validator.set_profile(&profile);
+    JsonValidator::ValidationResult r = validator.run(parser, *json_file);
+
+    if (record_profile_filename && !profile.save_file(record_profile_filename))
+        return 1;
 
     if (r.success) {
         fprintf(stdout, "Validation of JSON file %s sucessfull.\n", argv[2]);